@@ -1,4 +1,19 @@
 #include "CC_ISIS.h"
+#include "ISISAdiTexture.h"
+#include "ISISAltTape.h"
+#include "ISISBands.h"
+#include "ISISBlit.h"
+#include "ISISDigitDrum.h"
+#include "ISISDamage.h"
+#include "ISISDigitFont.h"
+#include "ISISReadout.h"
+#include "ISISSchedule.h"
+#include "ISISPalette.h"
+#include "ISISSnapshot.h"
+#include "ISISPresent.h"
+#include "ISISLabelCache.h"
+#include "ISISOverdraw.h"
+#include "ISISPerf.h"
 #include "Images/isisFont.h"
 #include "Sprites/isisBg.h"
 #include "Sprites/attBackground.h"
@@ -14,13 +29,6 @@
 #define PITCH_LINE_MEDIUM 27 // 5° tick marks
 #define PITCH_LINE_WIDE   54 // 10° tick marks (labeled)
 
-#define ATT_LEFT_EDGE 76
-#define ATT_TOP_EDGE  56
-#define ATT_HORIZON   194
-#define ALT_LEFT_EDGE 398
-#define ATT_WIDTH     320
-#define ATT_HEIGHT    350
-
 LGFX_Sprite attSprite(&lcd);   // Main attitude display
 
 LGFX_Sprite slipSprite(&attSprite);  // Roll pointer and slip skid indicator
@@ -28,90 +36,403 @@ LGFX_Sprite slipSprite(&attSprite);  // Roll pointer and slip skid indicator
 LGFX_Sprite ladderValSprite(&attSprite); // Used to hold the scale numbers on the pitch ladder
 LGFX_Sprite blackoutArcSprite(&attSprite);  // Arc to punch-out the top and bottom of the attSprite
 LGFX_Sprite speedSprite(&lcd); // Holds the speed tape
+LGFX_Sprite speedStrip;        // The whole speed tape, pre-rendered in PSRAM
+int32_t     speedStripTop = INT32_MIN; // speedStrip row now at the top of speedSprite, INT32_MIN if none
+unsigned long speedScrolls = 0, speedRedraws = 0;
 
 LGFX_Sprite altSprite(&lcd);         // Holds the alt tape
 LGFX_Sprite alt100Sprite(&altSprite);   
+LGFX_Sprite altLabelSprite;         // Scratch for rendering the alt tape labels
+AltTape     altTape;                // Pre-rendered alt tape marks and labels
+
+// Rolling altitude counter. Each drum holds its glyphs centred in equal cells
+// the height of one roll, so the glyph rolling in is one cell above.
+DigitDrum      altThousandsDrum; // 0..9, one 30 px column each for thousands and ten-thousands
+DigitDrum      altHundredsDrum;  // 0..9
+DigitDrum      alt20Drum;        // "00" .. "80"
+// alt100Sprite's background, magenta already black.
+static constexpr auto ALT_BG_PIXELS = imagePixels(ALTBG_IMG_DATA, 8184, pixelColor(TFT_BLACK));
+
+// The readouts below the attitude area. They are only drawn and pushed when their text changes.
+Readout   pressureReadout; // QNH / STD
+Readout   machReadout;
+DigitFont pressureDigits; // QNH, blue at size 1.0
+DigitFont stdDigits;      // "STD", blue at size 1.2
+DigitFont machDigits;     // green at size 1.0
+
+PitchLabelCache ladderLabels; // Pre-rotated pitch ladder numbers
+
+// Roll pointer / slip ball images as Pixels, magenta where transparent.
+// Only the ball half of slipSprite is redrawn, and only when the ball moves a whole pixel.
+static constexpr auto ROLL_POINTER_PIXELS = imagePixels(ROLLPOINTER_IMG_DATA, 8184, pixelColor(TFT_MAGENTA));
+static constexpr auto ROLL_SLIP_PIXELS    = imagePixels(ROLLSLIP_IMG_DATA, 8184, pixelColor(TFT_MAGENTA));
+
+RunImage staticOverlay; // drawBackground() overlays, compiled at boot
+
+// Visible part of each attSprite row inside the blackout arcs. Once built, the
+// arcs are drawn once and nothing writes outside these spans again.
+RowSpan        attVisible[ATT_HEIGHT];
+const RowSpan *attMask = nullptr;
+
+// Where the attitude stages draw: attSprite, which present() uploads, or with
+// attDirect the attitude's place in the presenter's back buffer (chooseAttTarget()).
+PixelSurface         attTarget;
+bool                 attDirectEnabled = true; // false: always draw in attSprite
+bool                 attDirect        = false;
+static unsigned long attDirectFrames  = 0;
+
+AttBand attBand(int32_t top, int32_t bottom)
+{
+    AttBand band;
+    band.target = surfaceRows(attTarget, top, bottom);
+    band.mask   = attMask ? attMask + top : nullptr;
+    band.top    = top;
+    return band;
+}
+
+#ifdef ISIS_ATT_BANDS_BUILD
+// The attitude and its overlays drawn in two bands at once, one on each core.
+BandRenderer attBands;
+#ifdef ISIS_ATT_BANDS
+bool attBandsEnabled = true;
+#else
+bool attBandsEnabled = false; // for the benchmarks to turn on
+#endif
+static const int32_t ATT_BAND_MIN_ROWS = 32;
+
+// Both bands draw from the compiled overlay and the label cache: what is drawn
+// without them goes through sprites the bands would share.
+static bool attBandsUsable()
+{
+#ifdef ISIS_OVERDRAW
+    return false; // overdraw is counted on one core
+#else
+    return attBandsEnabled && attBands.running() && staticOverlay.valid() && ladderLabels.enabled;
+#endif
+}
+#endif
+
+#ifdef ISIS_ADI_TEXTURE_BUILD
+AdiTexture adiTexture; // Pre-rendered attitude ball
+#endif
 
-LGFX_Sprite kohlsSprite(&lcd);
+// What changed in each sprite since it was pushed, and so all present() pushes.
+// The inputs the panel was last drawn from decide what changed.
+Damage       speedDamage, altDamage, attDamage;
+bool         damageTracking = true; // false: push every sprite whole, every frame
+bool         panelDirty     = true; // the panel may not show the sprites: push them whole next frame
+static float panelPitch, panelBank, panelBall, panelAlt;
+static bool  panelNeg;
+
+#ifdef ISIS_PERF_STATS
+static uint32_t panelBytes = 0, panelBytesFull = 0; // this frame, pushed and had everything been pushed whole
+#define PANEL_BYTES(pushed, full) (panelBytes += (pushed), panelBytesFull += (full))
+#else
+#define PANEL_BYTES(pushed, full) ((void)0)
+#endif
 
+#ifdef ISIS_DAMAGE_OUTLINE
+// Last frame's outlines, painted over by pushing their rectangles again.
+struct DamageOutlines {
+    const Damage *damage = nullptr;
+    DamageRect    rects[Damage::MAX_RECTS];
+    int           count = 0;
+};
+static DamageOutlines damageOutlines[3];
+// The attitude's when it is drawn in place, in frame coordinates. Those go on the panel after the flip,
+// as the back buffer they would otherwise be drawn in is drawn over again next frame.
+static DamageOutlines inPlaceOutlines;
+
+static void drawInPlaceOutlines()
+{
+    for (int i = 0; i < inPlaceOutlines.count; i++) {
+        const DamageRect &r = inPlaceOutlines.rects[i];
+        lcd.drawRect(r.x, r.y, r.w, r.h, TFT_MAGENTA);
+    }
+}
+#endif
 
 
+
+#ifdef ISIS_OVERDRAW
+// LovyanGFX primitives are counted by their bounding box, clipped to the sprite's clip rect.
+static void overdrawRect(LGFX_Sprite &sprite, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    int32_t cx, cy, cw, ch;
+    sprite.getClipRect(&cx, &cy, &cw, &ch);
+    int32_t x1 = min(x + w, cx + cw), y1 = min(y + h, cy + ch);
+    x = max(x, cx);
+    y = max(y, cy);
+    overdraw.rect((const uint8_t *)sprite.getBuffer(), x, y, x1 - x, y1 - y);
+}
+
+// Text box from the sprite's font, size and datum.
+static void overdrawText(LGFX_Sprite &sprite, const char *text, int32_t x, int32_t y)
+{
+    int32_t w     = sprite.textWidth(text);
+    int32_t h     = sprite.fontHeight();
+    uint8_t datum = sprite.getTextDatum();
+    overdrawRect(sprite, x - (datum & 3) * w / 2, y - ((datum >> 2) & 3) * h / 2, w, h);
+}
+
+static void overdrawText(LGFX_Sprite &sprite, long number, int32_t x, int32_t y)
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%ld", number);
+    overdrawText(sprite, text, x, y);
+}
+
+#define OVERDRAW_RECT(sprite, x, y, w, h) overdrawRect(sprite, x, y, w, h)
+#define OVERDRAW_TEXT(sprite, text, x, y) overdrawText(sprite, text, x, y)
+#define OVERDRAW_PUSH(sprite)             overdraw.pushed((const uint8_t *)(sprite).getBuffer())
+#else
+#define OVERDRAW_RECT(sprite, x, y, w, h) ((void)0)
+#define OVERDRAW_TEXT(sprite, text, x, y) ((void)0)
+#define OVERDRAW_PUSH(sprite)             ((void)0)
+#endif
+
 CC_ISIS::CC_ISIS()
 {
 }
 
+// In internal RAM if it fits, else PSRAM: at 16 bits (-DISIS_RGB565) the sprites don't all fit.
+static void *createSprite(LGFX_Sprite &sprite, int32_t w, int32_t h)
+{
+    sprite.setColorDepth(ISIS_COLOR_DEPTH);
+    if (void *buffer = sprite.createSprite(w, h)) return buffer;
+    sprite.setPsram(true);
+    return sprite.createSprite(w, h);
+}
+
 void CC_ISIS::setupSprites()
 {
     // bgSprite.setColorDepth(8);
     // bgSprite.createSprite(ISISBG_IMG_WIDTH, ISISBG_IMG_HEIGHT);
     // bgSprite.pushImage(0, 0, ISISBG_IMG_WIDTH, ISISBG_IMG_HEIGHT, ISISBG_IMG_DATA);
 
-    attSprite.setColorDepth(8);
-    attSprite.createSprite(320, 350);
+    createSprite(attSprite, 320, 350);
+    attTarget = surfaceOf(attSprite);
     attSprite.loadFont(A320ISIS24);
     attSprite.setTextColor(TFT_WHITE);
     attSprite.setTextSize(1.0f);
     attSprite.setTextDatum(CC_DATUM);
 
-    slipSprite.setColorDepth(8);
-    slipSprite.createSprite(ROLLSLIP_IMG_WIDTH*2+ROLLPOINTER_IMG_WIDTH, ROLLSLIP_IMG_HEIGHT + ROLLPOINTER_IMG_HEIGHT);
+    createSprite(slipSprite, ROLLSLIP_IMG_WIDTH*2+ROLLPOINTER_IMG_WIDTH, ROLLSLIP_IMG_HEIGHT + ROLLPOINTER_IMG_HEIGHT);
     slipSprite.fillSprite(TFT_MAGENTA);
-    slipSprite.pushImage(slipSprite.width()/2 - ROLLPOINTER_IMG_WIDTH/2, 0, ROLLPOINTER_IMG_WIDTH, ROLLPOINTER_IMG_HEIGHT, ROLLPOINTER_IMG_DATA, 8184);
     slipSprite.setPivot(ROLLSLIP_IMG_WIDTH, 159);  // 159 from ref image. dist from tip to center.
+    {
+        PixelSurface slip = surfaceOf(slipSprite);
+        for (int y = 0; y < ROLLPOINTER_IMG_HEIGHT; y++)
+            memcpy(slip.row(y) + slip.width / 2 - ROLLPOINTER_IMG_WIDTH / 2, ROLL_POINTER_PIXELS.data + y * ROLLPOINTER_IMG_WIDTH,
+                   ROLLPOINTER_IMG_WIDTH * sizeof(Pixel));
+    }
 
-    ladderValSprite.setColorDepth(8);
-    ladderValSprite.createSprite(45, 28); // Hold two digits. Digits are 24 high
+    createSprite(ladderValSprite, 45, 28); // Hold two digits. Digits are 24 high
     ladderValSprite.setPivot(25, 14);
     ladderValSprite.setTextColor(TFT_WHITE, TFT_BLACK);
     ladderValSprite.setTextDatum(CL_DATUM);
     ladderValSprite.loadFont(A320ISIS24);
+    ladderLabels.begin(&ladderValSprite);
+#ifdef ISIS_ADI_TEXTURE_BUILD
+    buildAdiTexture();
+#endif
 
-    blackoutArcSprite.setColorDepth(8);
-    blackoutArcSprite.createSprite(BLACKOUTARC_IMG_WIDTH + 2, BLACKOUTARC_IMG_HEIGHT); // make it a little wider to fix any rotation integer math
+    createSprite(blackoutArcSprite, BLACKOUTARC_IMG_WIDTH + 2, BLACKOUTARC_IMG_HEIGHT); // make it a little wider to fix any rotation integer math
     blackoutArcSprite.fillSprite(TFT_BLACK);
     blackoutArcSprite.pushImage(1, 0, BLACKOUTARC_IMG_WIDTH, BLACKOUTARC_IMG_HEIGHT, BLACKOUTARC_IMG_DATA);
     blackoutArcSprite.setPivot(BLACKOUTARC_IMG_WIDTH / 2, BLACKOUTARC_IMG_HEIGHT / 2);
+    buildStaticOverlay();
 
-    speedSprite.setColorDepth(8);
-    speedSprite.createSprite(ATT_LEFT_EDGE - 1, attSprite.height());
+    createSprite(speedSprite, ATT_LEFT_EDGE - 1, attSprite.height());
     speedSprite.loadFont(A320ISIS24);
     speedSprite.setColor(TFT_LIGHTGRAY);
     speedSprite.setTextColor(TFT_LIGHTGRAY, TFT_BLACK);
     speedSprite.setTextDatum(CR_DATUM);
+    buildSpeedStrip();
 
-    altSprite.setColorDepth(8);
-    altSprite.createSprite(ALT_LEFT_EDGE, attSprite.height());
+    createSprite(altSprite, ALT_LEFT_EDGE, attSprite.height());
     altSprite.loadFont(A320ISIS24);
     altSprite.setColor(TFT_LIGHTGRAY);
     altSprite.setTextColor(TFT_LIGHTGRAY, TFT_BLACK);
     altSprite.setTextDatum(CL_DATUM);
 
+    createSprite(altLabelSprite, 64, 36);
+    altLabelSprite.loadFont(A320ISIS24);
+    altLabelSprite.setTextColor(TFT_LIGHTGRAY, TFT_BLACK);
+    altLabelSprite.setTextDatum(CL_DATUM);
+    altTape.begin(min(altSprite.width(), lcd.width() - (ALT_LEFT_EDGE - 2)), &altLabelSprite); // only the on-screen columns
 
-    alt100Sprite.setColorDepth(8);
-    alt100Sprite.createSprite(ALTBG_IMG_WIDTH, ALTBG_IMG_HEIGHT);
+    createSprite(alt100Sprite, ALTBG_IMG_WIDTH, ALTBG_IMG_HEIGHT);
     alt100Sprite.pushImage(0, 0, ALTBG_IMG_WIDTH, ALTBG_IMG_HEIGHT, ALTBG_IMG_DATA, 8184);
     alt100Sprite.loadFont(A320ISIS24);
     alt100Sprite.setTextColor(TFT_GREEN);
     alt100Sprite.setTextDatum(CR_DATUM);
+    buildAltDrums();
 
-    kohlsSprite.setColorDepth(8);
-    kohlsSprite.createSprite(120, 33);
-    kohlsSprite.loadFont(A320ISIS24);
-    kohlsSprite.setTextDatum(TL_DATUM);
-    kohlsSprite.setTextColor(TFT_BLUE);
+    pressureReadout.begin(120, 33);
+    machReadout.begin(120, 33);
+    for (Readout *readout : { &pressureReadout, &machReadout }) {
+        readout->sprite().loadFont(A320ISIS24);
+        readout->sprite().setTextDatum(TL_DATUM);
+    }
+    {
+        // Only needed while the readout glyphs are rendered.
+        LGFX_Sprite scratch;
+        scratch.setColorDepth(ISIS_COLOR_DEPTH);
+        scratch.createSprite(48, 48);
+        scratch.loadFont(A320ISIS24);
+        pressureDigits.begin(&scratch, 1.0f, TFT_BLUE, TFT_BLACK);
+        stdDigits.begin(&scratch, 1.2f, TFT_BLUE, TFT_BLACK);
+        machDigits.begin(&scratch, 1.0f, TFT_GREEN, TFT_BLACK);
+    }
+
+    speedDamage.setBounds(speedSprite.width(), speedSprite.height());
+    altDamage.setBounds(min(altSprite.width(), lcd.width() - (ALT_LEFT_EDGE - 2)), altSprite.height());
+    attDamage.setBounds(attSprite.width(), attSprite.height());
+
+#ifdef ISIS_OVERDRAW
+    for (LGFX_Sprite *sprite : { &attSprite, &speedSprite, &altSprite, &alt100Sprite, &pressureReadout.sprite(), &machReadout.sprite() }) {
+        const char *names[] = { "att", "speed", "alt", "alt100", "qnh", "mach" };
+        overdraw.addSurface(names[overdraw.surfaceCount()], (const uint8_t *)sprite->getBuffer(), sprite->width(), sprite->height());
+    }
+#endif
 }
 
-void CC_ISIS::begin()
+// What a frame is drawn in, each at its own rate, by FrameLayer. The altitude tape is part of the
+// attitude: its counter is drawn in the attitude sprite.
+static const FrameScheduler::Layer FRAME_LAYERS[] = {
+    { "attitude", 1, 0 },
+    { "speed", 1, 0 },
+    { "qnh", 16, 5 }, // changes a few times a flight; on odd frames, mach on even ones
+    { "mach", 8, 2 },
+};
+FrameScheduler frameScheduler;
+
+#ifdef ISIS_PALETTE
+// The palette the flip shows the frame through (ISISPalette.h), and the theme and level it was built
+// for, -1 before the first.
+static Palette displayPalette;
+static int     paletteShown = -1;
+
+// Below this brightness the backlight is near its floor, so the palette dims too: to
+// PALETTE_MIN_LEVEL at 1%.
+static const int     PALETTE_DIM_BELOW = 20;
+static const uint8_t PALETTE_MIN_LEVEL = 96;
+
+// Build the palette again when the theme or brightness changed; the next flip sends the whole frame.
+static void updatePalette()
 {
-    loadSettings();
+    if (!framePresenter.doubleBuffered()) {
+        // No back buffer (no PSRAM for it) means no flip to show a palette through: the panel shows
+        // the RGB332 codes as they are. Say so once, and don't keep a theme that can't be shown.
+        if (paletteShown == -1) perfStatus("palette: no back buffer; night theme and dimming are off");
+        paletteShown = 0;
+        if (isisSettings.displayTheme) {
+            isisSettings.displayTheme = 0;
+            saveSettings();
+        }
+        return;
+    }
+    const int     percent = constrain(isisState.lcdBrightness, 1, PALETTE_DIM_BELOW);
+    const uint8_t level   = PALETTE_MIN_LEVEL + (255 - PALETTE_MIN_LEVEL) * (percent - 1) / (PALETTE_DIM_BELOW - 1);
+    const int     shown   = isisSettings.displayTheme << 8 | level;
+    if (shown == paletteShown) return;
+    paletteShown = shown;
+    displayPalette.build(isisSettings.displayTheme ? Palette::NIGHT : Palette::DAY, level);
+    framePresenter.setPalette(displayPalette.colors());
+}
+#endif
 
-    lcd.setColorDepth(8);
-    lcd.init();
+// Heap the panel, sprites, caches and back buffer took in begin().
+uint32_t bootRamBytes = 0, bootPsramBytes = 0;
+
+#ifdef ISIS_RENDER_TASK
+// With -DISIS_RENDER_TASK the frames are drawn and flipped by a task of their own on ISIS_RENDER_CORE,
+// while the Arduino loop on the other core takes in the Connector's messages. Flight data goes into
+// the loop's intakeState, published once a loop through a seqlock (ISISSnapshot.h), and the render
+// task copies the latest at the start of each frame: neither waits on the other. The messages that do
+// more than set a field (power, brightness, pixel clock, theme) draw or touch the panel, so they are
+// queued and done by the render task between frames. What the render task sends back, status lines
+// and settings to save, goes through the loop too: the serial port and the EEPROM are MobiFlight's,
+// used by the loop at the same time (perfStatusBegin(), settingsBegin()).
+struct IntakeSnapshot {
+    ISISState     state;
+    uint32_t      published;  // its number, from 1
+    uint32_t      messages;   // flight data messages with IDs above 0 to date; each wakes a device-managed display
+    unsigned long receivedUs; // micros() at the first message in it not in the one before
+};
+
+struct RenderCommand {
+    int16_t id;
+    char    setPoint[16];
+};
+
+static const uint32_t RENDER_STACK    = 8192; // the Arduino loop's
+static const int      RENDER_COMMANDS = 8;
+static const uint32_t RENDER_AWAKE_MS = 100; // longest the render task goes without sleeping
+
+static ISISState               intakeState; // the loop's
+static bool                    intakeDirty      = false;
+static unsigned long           intakeReceivedUs = 0;
+static uint32_t                intakeMessages   = 0;
+static uint32_t                intakePublishes  = 0;
+static Seqlock<IntakeSnapshot> intake;
+static QueueHandle_t           renderCommands   = nullptr;
+// Commands the queue had no room for, the render task being busy (the benchmarks, a settings save): the
+// latest of each message ID, in the order they first came, sent on by update().
+static RenderCommand           heldCommands[RENDER_COMMANDS];
+static int                     heldCount        = 0;
+static uint32_t                commandsMerged   = 0; // replaced by a later one with the same ID while held
+static uint32_t                commandsDropped  = 0; // with nowhere to go: every held slot another ID's
+static volatile TaskHandle_t   renderTaskHandle = nullptr;
+static volatile bool           renderStop       = false;
+
+// Render side, for the statistics.
+static uint32_t      snapshotRetries = 0; // copies started again, the loop publishing meanwhile
+static unsigned long freshFrames     = 0; // frames drawn with data newer than the frame before's
+static PerfSample    intakeLatency;       // us from a message coming in to the first frame drawn with it
+
+static void holdCommand(const RenderCommand &command)
+{
+    for (int i = 0; i < heldCount; i++)
+        if (heldCommands[i].id == command.id) {
+            heldCommands[i] = command;
+            commandsMerged++;
+            return;
+        }
+    if (heldCount == RENDER_COMMANDS) {
+        commandsDropped++;
+        return;
+    }
+    heldCommands[heldCount++] = command;
+}
 
-    setupSprites();
+// As many held commands as the queue has room for, oldest first.
+static void sendHeldCommands()
+{
+    int sent = 0;
+    while (sent < heldCount && xQueueSend(renderCommands, &heldCommands[sent], 0) == pdTRUE) sent++;
+    if (!sent) return;
+    heldCount -= sent;
+    memmove(heldCommands, heldCommands + sent, heldCount * sizeof(RenderCommand));
+}
 
-    lcd.setBrightness(brightnessGamma(isisSettings.lcdBrightness));
-    isisState.lcdBrightness = isisSettings.lcdBrightness;
+static void publishIntake()
+{
+    IntakeSnapshot s;
+    s.state      = intakeState;
+    s.published  = ++intakePublishes;
+    s.messages   = intakeMessages;
+    s.receivedUs = intakeReceivedUs;
+    intake.publish(s);
+    intakeDirty = false;
+}
+#endif
+
+static void initPanel()
+{
+    lcd.init();
+    lcd.setBrightness(isisState.powerState == PowerState::POWER_OFF ? 0 : brightnessGamma(isisState.lcdBrightness));
 
 #ifdef USE_GUITION_SCREEN
     lcd.setRotation(3); // Puts the USB jack at the bottom on Guition screen.
@@ -120,10 +441,70 @@ void CC_ISIS::begin()
 #endif
 
     lcd.fillScreen(TFT_BLACK);
+}
+
+// Tell the presenter the frame period and line time the bus asks for.
+static void setPanelTiming()
+{
+    const auto     bus    = lcd._bus_instance.config();
+    const auto     panel  = lcd._panel_instance.config();
+    const uint32_t hTotal = panel.panel_width + bus.hsync_front_porch + bus.hsync_pulse_width + bus.hsync_back_porch;
+    const uint32_t vTotal = panel.panel_height + bus.vsync_front_porch + bus.vsync_pulse_width + bus.vsync_back_porch;
+    framePresenter.setTiming((uint64_t)hTotal * vTotal * 1000000 / bus.freq_write, (uint64_t)hTotal * 1000000 / bus.freq_write);
+}
+
+// Pace the frames to isisSettings.frameRate. Double buffered, each frame is shown from a vsync, so
+// the period is rounded to a whole number of refreshes: otherwise the frames would alternate between
+// being on the panel for one refresh and for two.
+static void applyFrameRate()
+{
+    uint32_t       periodUs  = isisSettings.frameRate ? 1000000UL / isisSettings.frameRate : 0;
+    const uint32_t refreshUs = framePresenter.framePeriodUs();
+    uint32_t       refreshes = 1;
+    if (periodUs && refreshUs && framePresenter.doubleBuffered()) {
+        refreshes = (periodUs + refreshUs / 2) / refreshUs;
+        refreshes = refreshes ? refreshes : 1;
+        periodUs  = refreshes * refreshUs;
+    }
+    frameScheduler.setPeriod(periodUs);
+    framePresenter.setFrameRefreshes(refreshes); // for what it counts as missed
+}
+
+void CC_ISIS::begin()
+{
+    loadSettings();
+    isisState.lcdBrightness = isisSettings.lcdBrightness;
+
+    const uint32_t freeRam   = ESP.getFreeHeap();
+    const uint32_t freePsram = ESP.getFreePsram();
+    lcd.setColorDepth(ISIS_PANEL_DEPTH);
+    initPanel();
+
+    setupSprites();
+
     lcd.setTextColor(TFT_WHITE, TFT_BLACK);
+
+    const auto bus = lcd._bus_instance.config();
+#ifdef ISIS_DOUBLE_BUFFER
+    framePresenter.begin(&lcd, bus.pin_vsync, bus.vsync_polarity, true);
+#else
+    framePresenter.begin(&lcd, bus.pin_vsync, bus.vsync_polarity, false);
+#endif
+    setPanelTiming();
+    frameScheduler.begin(FRAME_LAYERS, sizeof(FRAME_LAYERS) / sizeof(FRAME_LAYERS[0]));
+    applyFrameRate();
+#ifdef ISIS_ATT_BANDS_BUILD
+    attBands.begin(ATT_HEIGHT, ATT_BAND_MIN_ROWS);
+#endif
+    bootRamBytes   = freeRam - ESP.getFreeHeap();
+    bootPsramBytes = freePsram - ESP.getFreePsram();
     // lcd.loadFont(A320ISIS24);
     // lcd.setTextDatum(CC_DATUM);
     // lcd.drawString("A320 STARTUP", 240, 240);
+
+#ifdef ISIS_RENDER_TASK
+    startRenderTask();
+#endif
 }
 
 void CC_ISIS::attach()
@@ -132,55 +513,194 @@ void CC_ISIS::attach()
 
 void CC_ISIS::detach()
 {
+#ifdef ISIS_RENDER_TASK
+    // Let the render task finish its frame and end.
+    if (renderTaskHandle) {
+        renderStop = true;
+        while (renderTaskHandle) delay(1);
+        vQueueDelete(renderCommands);
+        renderCommands = nullptr;
+        heldCount      = 0;
+        perfStatusFlush();
+        settingsFlush();
+    }
+#endif
+    // Then the helpers' tasks on the other core, so a later begin() doesn't start second copies.
+    framePresenter.end();
+#ifdef ISIS_ATT_BANDS_BUILD
+    attBands.end();
+#endif
 }
 
-void CC_ISIS::set(int16_t messageID, char *setPoint)
+#ifdef ISIS_RENDER_TASK
+void CC_ISIS::startRenderTask()
+{
+    intakeState = isisState;
+    publishIntake();
+    renderCommands = xQueueCreate(RENDER_COMMANDS, sizeof(RenderCommand));
+    if (!renderCommands) return; // the loop draws the frames
+    perfStatusBegin();
+    settingsBegin();
+
+    renderStop = false;
+    TaskHandle_t task;
+    if (xTaskCreatePinnedToCore(renderTask, "isisRender", RENDER_STACK, this, 1, &task, ISIS_RENDER_CORE) != pdPASS) {
+        vQueueDelete(renderCommands);
+        renderCommands = nullptr;
+        return;
+    }
+    renderTaskHandle = task;
+}
+
+void CC_ISIS::renderTask(void *arg)
+{
+    CC_ISIS *isis = (CC_ISIS *)arg;
+
+    // Unpaced, or paced faster than the frames can be drawn, the scheduler never sleeps, and single
+    // buffered the flip doesn't wait for vsync either. Then a tick's sleep now and then lets core 0's
+    // idle task in to feed the watchdog.
+    unsigned long sleptMs = millis();
+    while (!renderStop) {
+        if (frameScheduler.wait()) sleptMs = millis();
+        isis->renderFrame();
+        if (millis() - sleptMs >= RENDER_AWAKE_MS) {
+            vTaskDelay(1);
+            sleptMs = millis();
+        }
+    }
+    renderTaskHandle = nullptr;
+    vTaskDelete(nullptr);
+}
+
+// Start of a frame on the render task: the queued messages, then the loop's latest flight data.
+void CC_ISIS::takeIntake()
+{
+    RenderCommand command;
+    while (xQueueReceive(renderCommands, &command, 0) == pdTRUE) apply(command.id, command.setPoint);
+
+    static uint32_t taken = 0, messagesTaken = 0;
+    if (intake.version() == taken) return;
+    IntakeSnapshot s;
+    snapshotRetries += intake.read(s);
+    taken = s.published;
+
+    // The rest is this side's: what the inputs are smoothed into, and the power and brightness the
+    // queued messages set.
+    ISISState state       = s.state;
+    state.lcdBrightness   = isisState.lcdBrightness;
+    state.powerState      = isisState.powerState;
+    state.forceRedraw     = isisState.forceRedraw;
+    state.shutdownStartMs = isisState.shutdownStartMs;
+    state.batteryStartMs  = isisState.batteryStartMs;
+    state.pitchAngle      = isisState.pitchAngle;
+    state.bankAngle       = isisState.bankAngle;
+    state.airspeed        = isisState.airspeed;
+    state.altitude        = isisState.altitude;
+    isisState             = state;
+
+    // setCommon() wakes a device-managed display on flight data; it doesn't see it here.
+    if (s.messages != messagesTaken && isisSettings.powerControl == PowerControl::DEVICE_MANAGED) powerStateSet(PowerState::POWER_ON);
+    messagesTaken = s.messages;
+
+    intakeLatency.add(micros() - s.receivedUs);
+    freshFrames++;
+}
+#endif
+
+// The ISIS messages that only set a field of the flight state, into state. False for the others.
+static bool setFlightData(ISISState &state, int16_t messageID, const char *setPoint)
 {
-    // Common messages are handled by the base class.
-    if (messageID < MSG_HSI_MIN)
-        setCommon(messageID, setPoint);
-    // ISIS-specific messages (IDs >= MSG_ISIS_MIN) go here when implemented.
     switch (messageID) {
     case 80: // Pitch
-        isisState.rawPitchAngle = atof(setPoint);
+        state.rawPitchAngle = atof(setPoint);
         break;
     case 72: // Bank
-        isisState.rawBankAngle = atof(setPoint);
+        state.rawBankAngle = atof(setPoint);
         break;
     case 60: // Airspeed
-        isisState.rawAirspeed = atof(setPoint);
+        state.rawAirspeed = atof(setPoint);
         break;
     case 71: // Ball slip/skid
-        isisState.ballPos = atof(setPoint);
+        state.ballPos = atof(setPoint);
         break;
     case 77: // Indicated Altitude
-        isisState.rawAltitude = atof(setPoint);
+        state.rawAltitude = atof(setPoint);
         break;
     case 100: // Pressure in mb
-        isisState.mbPressure = atoi(setPoint);
+        state.mbPressure = atoi(setPoint);
         break;
     case 101: // are we in std pressure mode
-        isisState.isStdPressure = atoi(setPoint);
+        state.isStdPressure = atoi(setPoint);
         break;
     case 102:  // Mach number
-        isisState.machSpeed = atof(setPoint);
+        state.machSpeed = atof(setPoint);
         break;
+    default:
+        return false;
     }
+    return true;
 }
 
-void CC_ISIS::drawAttitude()
+void CC_ISIS::set(int16_t messageID, char *setPoint)
+{
+#ifdef ISIS_RENDER_TASK
+    if (renderTaskHandle) {
+        // Flight data waits in intakeState for update() to publish it; the rest for the render task.
+        if (setCommonData(intakeState, messageID, setPoint) || setFlightData(intakeState, messageID, setPoint)) {
+            if (!intakeDirty) intakeReceivedUs = micros();
+            intakeDirty = true;
+            if (messageID > 0) intakeMessages++;
+            return;
+        }
+        RenderCommand command;
+        command.id = messageID;
+        strlcpy(command.setPoint, setPoint, sizeof(command.setPoint));
+        // Never wait for the render task: that would stop the intake. Behind held ones, so they stay in order.
+        if (!heldCount && xQueueSend(renderCommands, &command, 0) == pdTRUE) return;
+        holdCommand(command);
+        return;
+    }
+#endif
+    apply(messageID, setPoint);
+}
+
+// A message, on the side that draws the frames.
+void CC_ISIS::apply(int16_t messageID, char *setPoint)
 {
+    // Common messages are handled by the base class.
+    if (messageID < MSG_HSI_MIN)
+        setCommon(messageID, setPoint);
+    if (setFlightData(isisState, messageID, setPoint)) return;
+    // ISIS-specific messages (IDs >= MSG_ISIS_MIN) go here when implemented.
+    switch (messageID) {
+    case 104: // Night theme: 1 = on, 0 = off. Shown through the palette (-DISIS_PALETTE)
+        isisSettings.displayTheme = atoi(setPoint) == 1 ? 1 : 0;
+        saveSettings();
+#ifndef ISIS_PALETTE
+        perfStatus("night theme: saved, but only shown in a build with -DISIS_PALETTE");
+#endif
+        break;
+    case 105: // Frame rate in frames per second, 0 = as fast as they can be drawn
+        isisSettings.frameRate = constrain(atoi(setPoint), 0, 120);
+        saveSettings();
+        applyFrameRate();
+        break;
+    }
+}
 
+// Pitch scaling factor (pixels per degree)
+static const float PITCH_SCALE = 8.0;
+
+static const uint16_t SKY_COLOR = TFT_BLUE;
+static const uint16_t GND_COLOR = 37316; // = TFT_BROWN;
+
+// Sky / ground fill of attSprite.
+void CC_ISIS::drawHorizonFill(const AttBand &band)
+{
     const int16_t CENTER_X = attSprite.width() / 2;
     const int16_t CENTER_Y = ATT_HORIZON-2;
 
-    const uint16_t HORIZON_COLOR = 0xFFFF;
-    const uint16_t SKY_COLOR     = TFT_BLUE;
-    const uint16_t GND_COLOR     = 37316; // = TFT_BROWN;
-
     float bankRad = isisState.bankAngle * PIf / 180.0f;
-    // Pitch scaling factor (pixels per degree)
-    const float PITCH_SCALE = 8.0;
 
     bool inverted = (isisState.bankAngle > 90.0 || isisState.bankAngle < -90.0);
 
@@ -189,9 +709,6 @@ void CC_ISIS::drawAttitude()
     // A negative isisState.pitchAngle (nose up) moves the horizon down (positive pixel offset).
     float horizonPixelOffset = inverted ? (isisState.pitchAngle * PITCH_SCALE) : (-isisState.pitchAngle * PITCH_SCALE);
 
-    attSprite.fillSprite(SKY_COLOR);
-
-    // Pre-calculate trig for the loop.
     // tanBank drives the slope of the horizon line across columns.
     // When pitch is non-zero, rotating that offset line by bankAngle shifts the Y-intercept
     // at CENTER_X by horizonPixelOffset/cosBank (not just horizonPixelOffset), so we need cosBank too.
@@ -201,34 +718,51 @@ void CC_ISIS::drawAttitude()
     float safeCosBank    = (fabsf(cosBank) < 0.01f) ? (cosBank < 0.0f ? -0.01f : 0.01f) : cosBank;
     float horizonCenterY = CENTER_Y + horizonPixelOffset / safeCosBank;
 
-    for (int16_t x = 0; x < attSprite.width(); x++) {
-        // Distance from center
-        int16_t dx = x - CENTER_X;
-
-        // Correct horizon Y for this column: the rotated-line equation gives
-        //   y = (CENTER_Y + horizonPixelOffset/cosBank) + dx*tanBank
-        // which matches the rotation-matrix method used for the pitch ladder and horizon line.
-        float horizonY = horizonCenterY + (dx * tanBank);
-
-        int16_t horizonPixel = round(horizonY);
-
-        // if (inverted) {
-        //     // When inverted, ground is ABOVE the horizon line
-        //     if (horizonPixel > 0) {
-        //         attSprite.drawFastVLine(x, 0, min((int16_t)ATT_HEIGHT, horizonPixel),  GND_COLOR);
-        //         if (x < SPEED_COL_WIDTH || x > (ATTITUDE_WIDTH - ALTITUDE_COL_WIDTH)) attitude.drawFastVLine(x, max((int16_t)0, horizonPixel), ATTITUDE_HEIGHT - max((int16_t)0, horizonPixel), (x < SPEED_COL_WIDTH || x > ATTITUDE_WIDTH - ALTITUDE_COL_WIDTH) ? DARK_SKY_COLOR : SKY_COLOR);
-        //         // attitude.drawFastVLine(x, 0, min((int16_t)attitude.height(), horizonPixel), GND_COLOR);
-        //     }
-        // } else {
-        // When upright, ground is BELOW the horizon line
-        if (horizonPixel < attSprite.height()) {
-            attSprite.drawFastVLine(x, max((int16_t)0, horizonPixel), ATT_HEIGHT - max((int16_t)0, horizonPixel), GND_COLOR);
-            // attSprite.drawLine(x, max((int16_t)0, horizonPixel), x, ATT_HEIGHT, GND_COLOR);
-        }
-    }
+    // The horizon Y for each column is horizonCenterY + dx*tanBank, which matches the
+    // rotation-matrix method used for the pitch ladder and horizon line. Ground is below it.
+    // Filled row by row (one sky run + one ground run per row) because the sprite is row-major.
+    fillHorizon(band.target, (float)CENTER_X, horizonCenterY, tanBank, pixelColor(SKY_COLOR), pixelColor(GND_COLOR), band.mask, band.top);
+}
+
+// Pitch ladder, 2.5° increments, 90 to -90 (0° is the horizon, drawn separately).
+// Wide (80) + number at every 10°; medium (60) at every 5°; small (40) at 2.5° / 7.5° offsets.
+static const struct PitchLine {
+    float deg;
+    int   width;
+    bool  num;
+} PITCH_LINES[] = {
+    // clang-format off
+    { 90.0, PITCH_LINE_WIDE, true },  { 87.5, PITCH_LINE_NARROW, false}, { 85.0, PITCH_LINE_MEDIUM, false}, { 82.5, PITCH_LINE_NARROW, false},
+    { 80.0, PITCH_LINE_WIDE, true },  { 77.5, PITCH_LINE_NARROW, false}, { 75.0, PITCH_LINE_MEDIUM, false}, { 72.5, PITCH_LINE_NARROW, false},
+    { 70.0, PITCH_LINE_WIDE, true },  { 67.5, PITCH_LINE_NARROW, false}, { 65.0, PITCH_LINE_MEDIUM, false}, { 62.5, PITCH_LINE_NARROW, false},
+    { 60.0, PITCH_LINE_WIDE, true },  { 57.5, PITCH_LINE_NARROW, false}, { 55.0, PITCH_LINE_MEDIUM, false}, { 52.5, PITCH_LINE_NARROW, false},
+    { 50.0, PITCH_LINE_WIDE, true },  { 47.5, PITCH_LINE_NARROW, false}, { 45.0, PITCH_LINE_MEDIUM, false}, { 42.5, PITCH_LINE_NARROW, false},
+    { 40.0, PITCH_LINE_WIDE, true },  { 37.5, PITCH_LINE_NARROW, false}, { 35.0, PITCH_LINE_MEDIUM, false}, { 32.5, PITCH_LINE_NARROW, false},
+    { 30.0, PITCH_LINE_WIDE, true },  { 27.5, PITCH_LINE_NARROW, false}, { 25.0, PITCH_LINE_MEDIUM, false}, { 22.5, PITCH_LINE_NARROW, false},
+    { 20.0, PITCH_LINE_WIDE, true },  { 17.5, PITCH_LINE_NARROW, false}, { 15.0, PITCH_LINE_MEDIUM, false}, { 12.5, PITCH_LINE_NARROW, false},
+    { 10.0, PITCH_LINE_WIDE, true },  {  7.5, PITCH_LINE_NARROW, false}, {  5.0, PITCH_LINE_MEDIUM, false}, {  2.5, PITCH_LINE_NARROW, false},
+    { -2.5, PITCH_LINE_NARROW, false},  { -5.0, PITCH_LINE_MEDIUM, false}, { -7.5, PITCH_LINE_NARROW, false}, {-10.0, PITCH_LINE_WIDE, true },
+    {-12.5, PITCH_LINE_NARROW, false},  {-15.0, PITCH_LINE_MEDIUM, false}, {-17.5, PITCH_LINE_NARROW, false}, {-20.0, PITCH_LINE_WIDE, true },
+    {-22.5, PITCH_LINE_NARROW, false},  {-25.0, PITCH_LINE_MEDIUM, false}, {-27.5, PITCH_LINE_NARROW, false}, {-30.0, PITCH_LINE_WIDE, true },
+    {-32.5, PITCH_LINE_NARROW, false},  {-35.0, PITCH_LINE_MEDIUM, false}, {-37.5, PITCH_LINE_NARROW, false}, {-40.0, PITCH_LINE_WIDE, true },
+    {-42.5, PITCH_LINE_NARROW, false},  {-45.0, PITCH_LINE_MEDIUM, false}, {-47.5, PITCH_LINE_NARROW, false}, {-50.0, PITCH_LINE_WIDE, true },
+    {-52.5, PITCH_LINE_NARROW, false},  {-55.0, PITCH_LINE_MEDIUM, false}, {-57.5, PITCH_LINE_NARROW, false}, {-60.0, PITCH_LINE_WIDE, true },
+    {-62.5, PITCH_LINE_NARROW, false},  {-65.0, PITCH_LINE_MEDIUM, false}, {-67.5, PITCH_LINE_NARROW, false}, {-70.0, PITCH_LINE_WIDE, true },
+    {-72.5, PITCH_LINE_NARROW, false},  {-75.0, PITCH_LINE_MEDIUM, false}, {-77.5, PITCH_LINE_NARROW, false}, {-80.0, PITCH_LINE_WIDE, true },
+    {-82.5, PITCH_LINE_NARROW, false},  {-85.0, PITCH_LINE_MEDIUM, false}, {-87.5, PITCH_LINE_NARROW, false}, {-90.0, PITCH_LINE_WIDE, true },
+    // clang-format on
+};
+
+void CC_ISIS::drawPitchLadder(const AttBand &band)
+{
+    const int16_t CENTER_X = attSprite.width() / 2;
+    const int16_t CENTER_Y = ATT_HORIZON-2;
+
+    float bankRad = isisState.bankAngle * PIf / 180.0f;
 
-    // --- 2. Draw Pitch Ladder (with correct math) ---
-    // cosBank was already computed above for the fill loop; compute sinBank here.
+    bool inverted = (isisState.bankAngle > 90.0 || isisState.bankAngle < -90.0);
+
+    float cosBank = cos(bankRad);
     float sinBank = sin(bankRad);
 
     auto drawPitchLine = [&](float pitchDegrees, int lineWidth, bool showNumber, uint16_t color) {
@@ -250,13 +784,10 @@ void CC_ISIS::drawAttitude()
         int16_t x2 = CENTER_X + p2x_unrot * cosBank - p2y_unrot * sinBank;
         int16_t y2 = CENTER_Y + p2x_unrot * sinBank + p2y_unrot * cosBank;
 
-        attSprite.drawLine(x1, y1, x2, y2, color);
+        drawSurfaceLine(band.target, x1, y1 - band.top, x2, y2 - band.top, pixelColor(color), band.mask);
         //        attSprite.drawWideLine(x1, y1, x2, y2, 2, color);
 
         if (showNumber && abs(pitchDegrees) >= 10) {
-            char pitchText[4];
-            sprintf(pitchText, "%d", (int)abs(pitchDegrees));
-
             float textOffset   = halfWidth + 15;
             float text1x_unrot = -textOffset;
             float texty_unrot  = verticalOffset;
@@ -264,46 +795,23 @@ void CC_ISIS::drawAttitude()
             int16_t textX1 = CENTER_X + text1x_unrot * cosBank - texty_unrot * sinBank;
             int16_t textY1 = CENTER_Y + text1x_unrot * sinBank + texty_unrot * cosBank;
 
-            ladderValSprite.fillSprite(TFT_BLACK);
-            ladderValSprite.drawString(pitchText, 2, ladderValSprite.height() / 2);
-            attSprite.setPivot(textX1, textY1);
-            ladderValSprite.pushRotated(inverted ? isisState.bankAngle + 180.0 : isisState.bankAngle, TFT_BLACK);
-            //            ladderValSprite.pushRotated(inverted ? isisState.bankAngle + 180.0 : isisState.bankAngle);
+            float labelAngle = inverted ? isisState.bankAngle + 180.0 : isisState.bankAngle;
+
+            if (ladderLabels.enabled) {
+                ladderLabels.draw(band.target, (int)abs(pitchDegrees), labelAngle, textX1, textY1 - band.top, band.mask);
+            } else {
+                char pitchText[4];
+                sprintf(pitchText, "%d", (int)abs(pitchDegrees));
+                ladderValSprite.fillSprite(TFT_BLACK);
+                ladderValSprite.drawString(pitchText, 2, ladderValSprite.height() / 2);
+                blitRotated(band.target, surfaceOf(ladderValSprite), ladderValSprite.getPivotX(), ladderValSprite.getPivotY(),
+                            textX1, textY1 - band.top, labelAngle, pixelColor(TFT_BLACK), band.mask);
+            }
         }
     };
 
-    // Define and draw all the pitch lines.
-    // 2.5° increments, 90 to -90 (0° is the horizon, drawn separately).
-    // Wide (80) + number at every 10°; medium (60) at every 5°; small (40) at 2.5° / 7.5° offsets.
-    const struct {
-        float deg;
-        int   width;
-        bool  num;
-    } pitch_lines[] = {
-        // clang-format off
-        { 90.0, PITCH_LINE_WIDE, true },  { 87.5, PITCH_LINE_NARROW, false}, { 85.0, PITCH_LINE_MEDIUM, false}, { 82.5, PITCH_LINE_NARROW, false},
-        { 80.0, PITCH_LINE_WIDE, true },  { 77.5, PITCH_LINE_NARROW, false}, { 75.0, PITCH_LINE_MEDIUM, false}, { 72.5, PITCH_LINE_NARROW, false},
-        { 70.0, PITCH_LINE_WIDE, true },  { 67.5, PITCH_LINE_NARROW, false}, { 65.0, PITCH_LINE_MEDIUM, false}, { 62.5, PITCH_LINE_NARROW, false},
-        { 60.0, PITCH_LINE_WIDE, true },  { 57.5, PITCH_LINE_NARROW, false}, { 55.0, PITCH_LINE_MEDIUM, false}, { 52.5, PITCH_LINE_NARROW, false},
-        { 50.0, PITCH_LINE_WIDE, true },  { 47.5, PITCH_LINE_NARROW, false}, { 45.0, PITCH_LINE_MEDIUM, false}, { 42.5, PITCH_LINE_NARROW, false},
-        { 40.0, PITCH_LINE_WIDE, true },  { 37.5, PITCH_LINE_NARROW, false}, { 35.0, PITCH_LINE_MEDIUM, false}, { 32.5, PITCH_LINE_NARROW, false},
-        { 30.0, PITCH_LINE_WIDE, true },  { 27.5, PITCH_LINE_NARROW, false}, { 25.0, PITCH_LINE_MEDIUM, false}, { 22.5, PITCH_LINE_NARROW, false},
-        { 20.0, PITCH_LINE_WIDE, true },  { 17.5, PITCH_LINE_NARROW, false}, { 15.0, PITCH_LINE_MEDIUM, false}, { 12.5, PITCH_LINE_NARROW, false},
-        { 10.0, PITCH_LINE_WIDE, true },  {  7.5, PITCH_LINE_NARROW, false}, {  5.0, PITCH_LINE_MEDIUM, false}, {  2.5, PITCH_LINE_NARROW, false},
-        { -2.5, PITCH_LINE_NARROW, false},  { -5.0, PITCH_LINE_MEDIUM, false}, { -7.5, PITCH_LINE_NARROW, false}, {-10.0, PITCH_LINE_WIDE, true },
-        {-12.5, PITCH_LINE_NARROW, false},  {-15.0, PITCH_LINE_MEDIUM, false}, {-17.5, PITCH_LINE_NARROW, false}, {-20.0, PITCH_LINE_WIDE, true },
-        {-22.5, PITCH_LINE_NARROW, false},  {-25.0, PITCH_LINE_MEDIUM, false}, {-27.5, PITCH_LINE_NARROW, false}, {-30.0, PITCH_LINE_WIDE, true },
-        {-32.5, PITCH_LINE_NARROW, false},  {-35.0, PITCH_LINE_MEDIUM, false}, {-37.5, PITCH_LINE_NARROW, false}, {-40.0, PITCH_LINE_WIDE, true },
-        {-42.5, PITCH_LINE_NARROW, false},  {-45.0, PITCH_LINE_MEDIUM, false}, {-47.5, PITCH_LINE_NARROW, false}, {-50.0, PITCH_LINE_WIDE, true },
-        {-52.5, PITCH_LINE_NARROW, false},  {-55.0, PITCH_LINE_MEDIUM, false}, {-57.5, PITCH_LINE_NARROW, false}, {-60.0, PITCH_LINE_WIDE, true },
-        {-62.5, PITCH_LINE_NARROW, false},  {-65.0, PITCH_LINE_MEDIUM, false}, {-67.5, PITCH_LINE_NARROW, false}, {-70.0, PITCH_LINE_WIDE, true },
-        {-72.5, PITCH_LINE_NARROW, false},  {-75.0, PITCH_LINE_MEDIUM, false}, {-77.5, PITCH_LINE_NARROW, false}, {-80.0, PITCH_LINE_WIDE, true },
-        {-82.5, PITCH_LINE_NARROW, false},  {-85.0, PITCH_LINE_MEDIUM, false}, {-87.5, PITCH_LINE_NARROW, false}, {-90.0, PITCH_LINE_WIDE, true },
-        // clang-format on
-    };
-
     uint16_t color = TFT_RED;
-    for (const auto &line : pitch_lines) {
+    for (const auto &line : PITCH_LINES) {
         if (line.deg > isisState.pitchAngle + 15.0f) continue;
         if (line.deg < isisState.pitchAngle - 17.5f) continue;
         float degFromCenter = fabsf(line.deg - isisState.pitchAngle);
@@ -314,15 +822,44 @@ void CC_ISIS::drawAttitude()
             drawPitchLine(line.deg, line.width, line.num, color);
         }
     }
+}
 
-    // -- Draw slip/skid and poitner. 
-    slipSprite.fillSprite(TFT_MAGENTA);
-    slipSprite.pushImage(slipSprite.width()/2 - ROLLPOINTER_IMG_WIDTH/2, 0, ROLLPOINTER_IMG_WIDTH, ROLLPOINTER_IMG_HEIGHT, ROLLPOINTER_IMG_DATA, 8184);
-    slipSprite.pushImage(min((int)(slipSprite.width() - ROLLSLIP_IMG_WIDTH),  max(0, (int)(slipSprite.width()/2 - ROLLSLIP_IMG_WIDTH/2 + (0.7 * isisState.ballPos)*ROLLSLIP_IMG_WIDTH))), ROLLPOINTER_IMG_HEIGHT, ROLLSLIP_IMG_WIDTH, ROLLSLIP_IMG_HEIGHT, ROLLSLIP_IMG_DATA, 8184);
-    attSprite.setPivot(attSprite.width()/2 - 12, ATT_HORIZON);
-    slipSprite.pushRotated(isisState.bankAngle, TFT_MAGENTA);
+// Move the ball in slipSprite to isisState.ballPos.
+// The pointer half of slipSprite is drawn once in setupSprites().
+void CC_ISIS::updateSlip()
+{
+    int16_t ballX = min((int)(slipSprite.width() - ROLLSLIP_IMG_WIDTH),  max(0, (int)(slipSprite.width()/2 - ROLLSLIP_IMG_WIDTH/2 + (0.7 * isisState.ballPos)*ROLLSLIP_IMG_WIDTH)));
+    if (ballX != _slipBallX) {
+        PixelSurface slip = surfaceOf(slipSprite);
+        for (int y = 0; y < ROLLSLIP_IMG_HEIGHT; y++) {
+            Pixel *row = slip.row(ROLLPOINTER_IMG_HEIGHT + y);
+            fillRun(row, slip.width, pixelColor(TFT_MAGENTA));
+            memcpy(row + ballX, ROLL_SLIP_PIXELS.data + y * ROLLSLIP_IMG_WIDTH, ROLLSLIP_IMG_WIDTH * sizeof(Pixel));
+        }
+        _slipBallX = ballX;
+        _slipRebuilds++;
+    } else {
+        _slipReuses++;
+    }
+}
 
+// The roll pointer and slip ball, as updateSlip() left them in slipSprite.
+void CC_ISIS::drawRollPointer(const AttBand &band)
+{
+    blitRotated(band.target, surfaceOf(slipSprite), slipSprite.getPivotX(), slipSprite.getPivotY(),
+                attSprite.width()/2 - 12, ATT_HORIZON - band.top, isisState.bankAngle, pixelColor(TFT_MAGENTA), band.mask);
+}
+
+void CC_ISIS::drawHorizonLine(const AttBand &band)
+{
+    const int16_t CENTER_X = attSprite.width() / 2;
+    const int16_t CENTER_Y = ATT_HORIZON-2;
 
+    const uint16_t HORIZON_COLOR = 0xFFFF;
+
+    float bankRad = isisState.bankAngle * PIf / 180.0f;
+    float cosBank = cos(bankRad);
+    float sinBank = sin(bankRad);
 
     // --- 3. Draw Horizon Line ---
     // The horizon is just a pitch line at 0 degrees.
@@ -335,8 +872,140 @@ void CC_ISIS::drawAttitude()
     int16_t hx2 = CENTER_X + (lineLength / 2.0) * cosBank - horiz_unrot_y * sinBank;
     int16_t hy2 = CENTER_Y + (lineLength / 2.0) * sinBank + horiz_unrot_y * cosBank;
 
-    attSprite.drawLine(hx1, hy1, hx2, hy2, HORIZON_COLOR);
-    attSprite.drawLine(hx1, hy1 + 1, hx2, hy2 + 1, HORIZON_COLOR); // Thicker line
+    // Rounded in attitude rows, so a band draws exactly its rows of the whole line.
+    hy1 -= band.top;
+    hy2 -= band.top;
+    drawSurfaceLine(band.target, hx1, hy1, hx2, hy2, pixelColor(HORIZON_COLOR), band.mask);
+    drawSurfaceLine(band.target, hx1, hy1 + 1, hx2, hy2 + 1, pixelColor(HORIZON_COLOR), band.mask); // Thicker line
+}
+
+#ifdef ISIS_ADI_TEXTURE_BUILD
+// Texture is wide enough for the longest line plus its label, and has a margin
+// above +90° and below -90° so those labels fit.
+static const int16_t ADI_TEXTURE_WIDTH  = 160;
+static const int16_t ADI_TEXTURE_MARGIN = 16;
+
+// Render the whole pitch ladder unrotated, once, at the same pixel offsets
+// drawPitchLadder() uses at wings level.
+void CC_ISIS::buildAdiTexture()
+{
+    const int16_t horizonRow = ADI_TEXTURE_MARGIN + (int16_t)(90 * PITCH_SCALE);
+    if (!adiTexture.begin(ADI_TEXTURE_WIDTH, 2 * horizonRow + 1, horizonRow, PITCH_SCALE)) return;
+
+    LGFX_Sprite  &tex = adiTexture.canvas();
+    LGFX_Sprite  &inv = adiTexture.invertedCanvas();
+    const int16_t cx  = adiTexture.centerX();
+
+    for (LGFX_Sprite *t : { &tex, &inv }) {
+        t->fillRect(0, 0, t->width(), horizonRow, SKY_COLOR);
+        t->fillRect(0, horizonRow, t->width(), 2, TFT_WHITE);
+        t->fillRect(0, horizonRow + 2, t->width(), t->height() - horizonRow - 2, GND_COLOR);
+    }
+
+    for (const auto &line : PITCH_LINES) {
+        float   halfWidth = line.width / 2.0;
+        int16_t y         = adiTexture.rowOf(line.deg);
+        tex.drawLine((int16_t)(cx - halfWidth), y, (int16_t)(cx + halfWidth), y, TFT_WHITE);
+        inv.drawLine((int16_t)(cx - halfWidth), y, (int16_t)(cx + halfWidth), y, TFT_WHITE);
+
+        if (line.num) {
+            char pitchText[4];
+            sprintf(pitchText, "%d", (int)abs(line.deg));
+            ladderValSprite.fillSprite(TFT_BLACK);
+            ladderValSprite.drawString(pitchText, 2, ladderValSprite.height() / 2);
+            int16_t textX = cx - (halfWidth + 15);
+            ladderValSprite.pushSprite(&tex, textX - (int16_t)ladderValSprite.getPivotX(), y - (int16_t)ladderValSprite.getPivotY(), TFT_BLACK);
+            // Turned half round its pivot, as drawPitchLadder() draws it at bank + 180.
+            blitRotated(surfaceOf(inv), surfaceOf(ladderValSprite), ladderValSprite.getPivotX(), ladderValSprite.getPivotY(), textX, y,
+                        180.0f, pixelColor(TFT_BLACK));
+        }
+    }
+
+    adiTexture.setBackground(pixelColor(SKY_COLOR), pixelColor(TFT_WHITE), pixelColor(GND_COLOR));
+}
+
+// Sky, ground, horizon and ladder in one pass over attSprite.
+void CC_ISIS::drawAttitudeTexture(const AttBand &band)
+{
+    // Only show the ladder lines drawPitchLadder() would (pitch -17.5° to +15°).
+    // The band reaches 14 rows past a numbered line for its label, 5 rows past the others,
+    // which stops short of the next label.
+    float minDeg = max(-90.0f, ceilf((isisState.pitchAngle - 17.5f) / 2.5f) * 2.5f);
+    float maxDeg = min(90.0f, floorf((isisState.pitchAngle + 15.0f) / 2.5f) * 2.5f);
+    auto  reach  = [](float deg) { return fmodf(deg, 10.0f) == 0.0f ? 14 : 5; };
+
+    adiTexture.draw(band.target, attSprite.width() / 2, ATT_HORIZON - 2 - band.top, isisState.pitchAngle, isisState.bankAngle,
+                    adiTexture.rowOf(minDeg) - reach(minDeg), adiTexture.rowOf(maxDeg) + reach(maxDeg), band.mask);
+}
+#endif
+
+void CC_ISIS::drawAttitude()
+{
+    updateSlip();
+    drawAttitudeBand(attBand());
+}
+
+// The attitude's stages, clipped to band. slipSprite must be up to date.
+void CC_ISIS::drawAttitudeBand(const AttBand &band)
+{
+#ifdef ISIS_ADI_TEXTURE
+    if (adiTexture.valid()) {
+        drawAttitudeTexture(band);
+        drawRollPointer(band);
+        return;
+    }
+#endif
+    drawHorizonFill(band);
+    drawPitchLadder(band);
+    drawRollPointer(band);
+    drawHorizonLine(band);
+}
+
+// Speed tape marks from fromKt down to (not including) toKt, the first one at row y.
+// Every 5 kt is 19 px (3.8 px/kt): number + short mark at 20s, long mark at 10s,
+// short mark at 5s up to 245 kt.
+static void drawSpeedMarks(LGFX_Sprite &sprite, int fromKt, int toKt, int y)
+{
+    for (int i = fromKt; i > toKt; i -= 5) {
+
+        if (i < 30) continue;
+
+        if (i % 20 == 0) {
+            sprite.drawNumber(i, sprite.width() - 6, y);
+            OVERDRAW_TEXT(sprite, i, sprite.width() - 6, y);
+            sprite.drawWideLine(70, y, 75, y, 1, TFT_WHITE);
+            OVERDRAW_RECT(sprite, 70, y, 6, 1);
+            // sprite.drawFastHLine(sprite.width() - 12, y, 5);
+            // sprite.drawFastHLine(sprite.width() - 12, y+1, 5);
+        } else if (i % 10 == 0) {
+            sprite.drawWideLine(65, y, 75, y, 1, TFT_WHITE);
+            OVERDRAW_RECT(sprite, 65, y, 11, 1);
+            // sprite.drawFastHLine(sprite.width() - 16, y, 10);
+            // sprite.drawFastHLine(sprite.width() - 16, y+1, 10);
+        } else if (i <= 245) {
+            sprite.drawWideLine(70, y, 75, y, 1, TFT_WHITE);
+            OVERDRAW_RECT(sprite, 70, y, 6, 1);
+            // sprite.drawFastHLine(sprite.width() - 12, y, 5);
+            // sprite.drawFastHLine(sprite.width() - 12, y+1, 5);
+        }
+
+        y += SPEED_MARK_SPACING;
+    }
+}
+
+// Render the whole tape, SPEED_TAPE_MAX down to 30 kt, into speedStrip once.
+void CC_ISIS::buildSpeedStrip()
+{
+    speedStrip.setPsram(true);
+    speedStrip.setColorDepth(ISIS_COLOR_DEPTH);
+    if (!speedStrip.createSprite(speedSprite.width(), SPEED_STRIP_MARGIN * 2 + (SPEED_TAPE_MAX - 30) / 5 * SPEED_MARK_SPACING + 1)) return;
+    speedStrip.loadFont(A320ISIS24);
+    speedStrip.setColor(TFT_WHITE);
+    speedStrip.setTextColor(TFT_LIGHTGRAY, TFT_BLACK);
+    speedStrip.setTextDatum(CR_DATUM);
+    speedStrip.fillSprite(TFT_BLACK);
+
+    drawSpeedMarks(speedStrip, SPEED_TAPE_MAX, 25, SPEED_STRIP_MARGIN);
 }
 
 void CC_ISIS::drawSpeedTape()
@@ -353,38 +1022,53 @@ void CC_ISIS::drawSpeedTape()
     const int   yOffset  = (int)(pixPerKt * fmodf(curSpeed, 20.0f)) - 35; // offset factor for non-centered arrow.
     const int   first20  = (int)(curSpeed / 20.0f) * 20;
 
-    const int speedMarkWidth = 6;
-
-    speedSprite.fillSprite(TFT_BLACK);
-    speedSprite.setColor(TFT_WHITE);
+    // The tape only moves: copy the window of the pre-rendered strip that puts
+    // the first20 + 60 mark at yOffset, exactly where drawSpeedTapeDirect() draws it.
+    // Small moves scroll what is already in speedSprite and copy in the new rows.
+    if (speedStrip.getBuffer() && first20 + 60 <= SPEED_TAPE_MAX) {
+        int32_t top = SPEED_STRIP_MARGIN + (SPEED_TAPE_MAX - first20 - 60) / 5 * SPEED_MARK_SPACING - yOffset;
+        if (speedStripTop != INT32_MIN && abs(top - speedStripTop) < speedSprite.height() / 2) {
+            scrollWindow(surfaceOf(speedSprite), surfaceOf(speedStrip), top, top - speedStripTop, pixelColor(TFT_BLACK));
+            speedScrolls++;
+        } else {
+            blitWindow(surfaceOf(speedSprite), surfaceOf(speedStrip), top, pixelColor(TFT_BLACK));
+            speedRedraws++;
+        }
+        if (top != speedStripTop) speedDamage.addAll();
+        speedStripTop = top;
+        present(speedSprite, 0, ATT_TOP_EDGE, speedDamage);
+        return;
+    }
 
-    int curY = +yOffset;
+    speedStripTop = INT32_MIN;
+    drawSpeedTapeDirect();
+}
 
-    //    Serial.printf("CurY: %d  first20: %d yOffset: %d\n", curY, first20, yOffset);
+// Draw the visible marks straight into speedSprite. Used above SPEED_TAPE_MAX
+// or if the strip could not be allocated.
+void CC_ISIS::drawSpeedTapeDirect()
+{
+    const float pixPerKt = 3.8f;
 
-    for (int i = first20 + 60; i > first20 - 60; i -= 5) {
+    const float curSpeed = max(isisState.airspeed, 30.0f);
+    const int   yOffset  = (int)(pixPerKt * fmodf(curSpeed, 20.0f)) - 35; // offset factor for non-centered arrow.
+    const int   first20  = (int)(curSpeed / 20.0f) * 20;
 
-        if (i < 30) continue;
+    speedSprite.fillSprite(TFT_BLACK);
+    OVERDRAW_RECT(speedSprite, 0, 0, speedSprite.width(), speedSprite.height());
+    speedSprite.setColor(TFT_WHITE);
 
-        if (i % 20 == 0) {
-            speedSprite.drawNumber(i, speedSprite.width() - 6, curY);
-            speedSprite.drawWideLine(70, curY, 75, curY, 1, TFT_WHITE);
-            // speedSprite.drawFastHLine(speedSprite.width() - 12, curY, 5);
-            // speedSprite.drawFastHLine(speedSprite.width() - 12, curY+1, 5);
-        } else if (i % 10 == 0) {
-            speedSprite.drawWideLine(65, curY, 75, curY, 1, TFT_WHITE);
-            // speedSprite.drawFastHLine(speedSprite.width() - 16, curY, 10);
-            // speedSprite.drawFastHLine(speedSprite.width() - 16, curY+1, 10);
-        } else if (i <= 245) {
-            speedSprite.drawWideLine(70, curY, 75, curY, 1, TFT_WHITE);
-            // speedSprite.drawFastHLine(speedSprite.width() - 12, curY, 5);
-            // speedSprite.drawFastHLine(speedSprite.width() - 12, curY+1, 5);
-        }
+    drawSpeedMarks(speedSprite, first20 + 60, first20 - 60, yOffset);
 
-        curY += (int)(pixPerKt * 5); // pixPerKt * 5
-    }
+    speedDamage.addAll();
+    present(speedSprite, 0, ATT_TOP_EDGE, speedDamage);
+}
 
-    speedSprite.pushSprite(0, ATT_TOP_EDGE);
+// The rolling counter is copied from the drums, not drawn with the font.
+static bool altDrumsUsable(float curAlt)
+{
+    // From 90,000' the ten-thousands would need two digits, which the drum doesn't hold.
+    return altThousandsDrum.valid() && altHundredsDrum.valid() && alt20Drum.valid() && curAlt < 90000.0f;
 }
 
 void CC_ISIS::drawAltTape()
@@ -399,14 +1083,66 @@ void CC_ISIS::drawAltTape()
 
     bool  isNeg  = (isisState.altitude < 0.0f);
     float curAlt = fabsf(isisState.altitude); // always non-negative; display NEG indicator for sub-sea-level
+
+    // The rolling counter.
+    if (altDrumsUsable(curAlt))
+        drawAltCounter(curAlt);
+    else
+        drawAltCounterDirect(curAlt);
+
+    // Show the NEG indicator on the screen if altitude < 0
+    if (isNeg) {
+        attSprite.drawString("N", 269, 208 - 56);
+        attSprite.drawString("G", 269, 292 - 56);
+        OVERDRAW_TEXT(attSprite, "N", 269, 208 - 56);
+        OVERDRAW_TEXT(attSprite, "G", 269, 292 - 56);
+        // "E" sits where the old flSprite was: CR_DATUM at (278, ATT_HORIZON)
+        attSprite.setTextDatum(CR_DATUM);
+        attSprite.drawString("E", 278, ATT_HORIZON);
+        OVERDRAW_TEXT(attSprite, "E", 278, ATT_HORIZON);
+        attSprite.setTextDatum(CC_DATUM);
+    }
+
+    // Draw the tape. The composed tape writes every on-screen column, so altSprite needs no clear.
+    // The box below is pushed over the tape, so those rows are dirty for the next frame.
+    const int boxY = ATT_HORIZON - alt100Sprite.height() / 2 - 1;
+    if (altTape.enabled && altTape.valid()) {
+        altTape.drawScrolled(surfaceOf(altSprite), curAlt, boxY, boxY + alt100Sprite.height());
+        if (altTape.moved) altDamage.addAll();
+    } else {
+        altTape.invalidate();
+        drawAltTapeDirect(curAlt);
+        altDamage.addAll();
+    }
+
+    // The counter: the box on the tape and the thousands on attSprite.
+    if (curAlt != panelAlt) {
+        altDamage.add(0, boxY, alt100Sprite.width(), alt100Sprite.height());
+        attDamage.add(attSprite.width() - 60, ATT_HORIZON - 20, 60, 37);
+        panelAlt = curAlt;
+    }
+
+    alt100Sprite.pushSprite(0, boxY);
+    OVERDRAW_PUSH(alt100Sprite);
+    OVERDRAW_RECT(altSprite, 0, boxY, alt100Sprite.width(), alt100Sprite.height());
+    present(altSprite, ALT_LEFT_EDGE - 2, ATT_TOP_EDGE, altDamage);
+
+    return;
+}
+
+// The digit box and the thousands digits, rendered with the font. Used if
+// the drums could not be allocated.
+void CC_ISIS::drawAltCounterDirect(float curAlt)
+{
     int   fl     = (int)(curAlt / 100);     // hundreds and above (e.g. 1234ft → fl=12)
 
     char buf[8];
 
     // Clear Sprites
-    altSprite.fillSprite(TFT_BLACK);
     alt100Sprite.fillSprite(TFT_BLACK);
     alt100Sprite.pushImage(0, 0, ALTBG_IMG_WIDTH, ALTBG_IMG_HEIGHT, ALTBG_IMG_DATA, 8184); // MagentaRGB
+    OVERDRAW_RECT(alt100Sprite, 0, 0, alt100Sprite.width(), alt100Sprite.height());
+    OVERDRAW_RECT(alt100Sprite, 0, 0, ALTBG_IMG_WIDTH, ALTBG_IMG_HEIGHT);
 
     // Compute the scroll state once; everything below uses these values.
     // dispUnit: the current 20-ft band label (changes only at band boundaries).
@@ -438,6 +1174,7 @@ void CC_ISIS::drawAltTape()
         int offsetTK = nearRollTK ? (int)(rollFraction * clipH) : 0 + 2;
 
         attSprite.fillRect(clipX, clipY, clipW, clipH, TFT_BLACK);
+        OVERDRAW_RECT(attSprite, clipX, clipY, clipW, clipH);
         attSprite.setClipRect(clipX, clipY, clipW, clipH);
         attSprite.setTextSize(1.2f);
         attSprite.setTextColor(TFT_GREEN);
@@ -446,17 +1183,21 @@ void CC_ISIS::drawAltTape()
         // Ten-thousands digit (left column, ~x=300). Only shown at >= 10,000 ft.
         if (nearRollTK) {
             attSprite.drawNumber(fl / 100 + 1, clipX + 28, centY + offsetTK - clipH);
+            OVERDRAW_TEXT(attSprite, fl / 100 + 1, clipX + 28, centY + offsetTK - clipH);
         }
         if (fl / 100 > 0) {
             attSprite.drawNumber(fl / 100, clipX + 28, centY + offsetTK);
+            OVERDRAW_TEXT(attSprite, fl / 100, clipX + 28, centY + offsetTK);
         }
 
         // Thousands digit (right column, x=318). Only shown at >= 1,000 ft.
         if (nearRollK) {
             attSprite.drawNumber(((fl / 10) % 10 + 1) % 10, clipX + clipW - 2, centY + offsetK - clipH);
+            OVERDRAW_TEXT(attSprite, ((fl / 10) % 10 + 1) % 10, clipX + clipW - 2, centY + offsetK - clipH);
         }
         if (fl / 10 > 0) {
             attSprite.drawNumber((fl / 10) % 10, clipX + clipW - 2, centY + offsetK);
+            OVERDRAW_TEXT(attSprite, (fl / 10) % 10, clipX + clipW - 2, centY + offsetK);
         }
 
         attSprite.clearClipRect();
@@ -476,8 +1217,10 @@ void CC_ISIS::drawAltTape()
         if (nearRoll) {
             // Next hundreds digit descends from above
             alt100Sprite.drawNumber((fl % 10 + 1) % 10, 24, offset);
+            OVERDRAW_TEXT(alt100Sprite, (fl % 10 + 1) % 10, 24, offset);
         }
         alt100Sprite.drawNumber(fl % 10, 24, centY + offset);
+        OVERDRAW_TEXT(alt100Sprite, fl % 10, 24, centY + offset);
         alt100Sprite.clearClipRect();
     }
 
@@ -490,106 +1233,547 @@ void CC_ISIS::drawAltTape()
     alt100Sprite.setTextSize(1.0f);
     sprintf(buf, "%02d", dispUnit % 100); // current label, descends off bottom
     alt100Sprite.drawString(buf, 70, curY);
+    OVERDRAW_TEXT(alt100Sprite, buf, 70, curY);
     sprintf(buf, "%02d", (dispUnit + 20) % 100); // next-higher, enters from above
     alt100Sprite.drawString(buf, 70, curY - (pxPerFt * 20.0f));
+    OVERDRAW_TEXT(alt100Sprite, buf, 70, curY - (pxPerFt * 20.0f));
+}
 
-    // Show the NEG indicator on the screen if altitude < 0
-    if (isNeg) {
-        attSprite.drawString("N", 269, 208 - 56);
-        attSprite.drawString("G", 269, 292 - 56);
-        // "E" sits where the old flSprite was: CR_DATUM at (278, ATT_HORIZON)
-        attSprite.setTextDatum(CR_DATUM);
-        attSprite.drawString("E", 278, ATT_HORIZON);
-        attSprite.setTextDatum(CC_DATUM);
+// The same counter copied from the drums: the box background and four columns,
+// each the cell on show plus the one rolling in above it.
+void CC_ISIS::drawAltCounter(float curAlt)
+{
+    int   fl           = (int)(curAlt / 100);
+    int   dispUnit     = (int)(curAlt / 20) * 20;
+    float sub20        = fmodf(curAlt, 20.0f);
+    bool  nearRoll     = (dispUnit % 100 >= 80);
+    float rollFraction = nearRoll ? (sub20 / 20.0f) : 0.0f;
+
+    // Thousands and ten-thousands, over the clip box on attSprite.
+    {
+        const int clipX = attSprite.width() - 60;
+        const int clipY = ATT_HORIZON - 20;
+        const int clipH = 37;
+        const int centY = clipY + clipH / 2 + 2;
+        const int top   = centY - clipH / 2; // current cell top when not rolling
+
+        bool nearRollK  = nearRoll && ((fl % 10) == 9);
+        bool nearRollTK = nearRollK && ((fl / 10) % 10 == 9);
+
+        int offsetK  = nearRollK ? (int)(rollFraction * clipH) : 2;
+        int offsetTK = nearRollTK ? (int)(rollFraction * clipH) : 2;
+
+        PixelSurface att = attTarget;
+        altThousandsDrum.draw(att, clipX, clipY, clipY + clipH, top + offsetTK, fl / 100 > 0 ? fl / 100 : DigitDrum::BLANK,
+                              nearRollTK ? fl / 100 + 1 : DigitDrum::BLANK);
+        altThousandsDrum.draw(att, clipX + 30, clipY, clipY + clipH, top + offsetK, fl / 10 > 0 ? (fl / 10) % 10 : DigitDrum::BLANK,
+                              nearRollK ? ((fl / 10) % 10 + 1) % 10 : DigitDrum::BLANK);
+    }
+
+    PixelSurface box = surfaceOf(alt100Sprite);
+    memcpy(box.pixels, ALT_BG_PIXELS.data, sizeof(ALT_BG_PIXELS.data));
+    ISIS_COUNT_PIXELS(box.pixels, ALTBG_IMG_WIDTH * ALTBG_IMG_HEIGHT);
+
+    // Hundreds digit, within the box's clip rows.
+    {
+        const int centY  = alt100Sprite.height() / 2 + 3;
+        int       offset = (int)(rollFraction * centY);
+        altHundredsDrum.draw(box, 0, 13, 13 + 38, centY + offset - centY / 2, fl % 10, nearRoll ? (fl % 10 + 1) % 10 : DigitDrum::BLANK);
     }
 
-    // Draw the tape.
+    // 20-ft labels, unclipped, so they are keyed over the box outline.
+    int curY = (int)(34 + sub20 * 2.5f);
+    alt20Drum.draw(box, 35, 0, box.height, curY - 25, (dispUnit % 100) / 20, ((dispUnit + 20) % 100) / 20, pixelColor(TFT_BLACK));
+}
+
+// Render the counter drums with the fonts, sizes and anchors drawAltCounterDirect() uses.
+void CC_ISIS::buildAltDrums()
+{
+    auto build = [](DigitDrum &drum, int16_t width, int16_t cellHeight, int cells, float textSize, int32_t x, int step, const char *format) {
+        if (!drum.begin(width, cellHeight, cells, pixelColor(TFT_BLACK))) return;
+        LGFX_Sprite &canvas = drum.canvas();
+        canvas.loadFont(A320ISIS24);
+        canvas.setTextSize(textSize);
+        canvas.setTextColor(TFT_GREEN);
+        canvas.setTextDatum(CR_DATUM);
+        char buf[8];
+        for (int i = 0; i < cells; i++) {
+            sprintf(buf, format, i * step);
+            canvas.drawString(buf, x, drum.cellTop(i) + cellHeight / 2);
+        }
+        canvas.unloadFont();
+    };
+
+    build(altThousandsDrum, 30, 37, 10, 1.2f, 28, 1, "%d");
+    build(altHundredsDrum, 35, alt100Sprite.height() / 2 + 3, 10, 1.2f, 24, 1, "%d");
+    build(alt20Drum, 50, 50, 5, 1.0f, 70 - 35, 20, "%02d");
+}
+
+// Clear altSprite and draw the marks and labels one by one. Used if the
+// pre-rendered tape could not be allocated.
+void CC_ISIS::drawAltTapeDirect(float curAlt)
+{
+    altSprite.fillSprite(TFT_BLACK);
+    OVERDRAW_RECT(altSprite, 0, 0, altSprite.width(), altSprite.height());
+
     // Each tick's y is computed directly from its altitude relative to curAlt,
     // so scrolling is pixel-smooth with no fmodf rollover artifacts.
     //   y = referenceY + (curAlt - tickAlt) * pixPerFt
     // Higher altitudes (tickAlt > curAlt) produce smaller y (higher on screen). ✓
-    const float pixPerFt    = 0.245f;
-    const float referenceY  = 179.0f; // y in altSprite where the current-alt tick sits. Found with trial and error
-    const int   markerWidth = 15;
     altSprite.setTextDatum(CL_DATUM);
 
     int baseTick = (int)floorf(curAlt / 100.0f) * 100; // nearest 100-ft band below curAlt
     for (int alt = baseTick + 900; alt >= baseTick - 900; alt -= 100) {
-        curY = (int)(referenceY + (curAlt - alt) * pixPerFt);
+        int curY = AltTape::markY(curAlt, alt);
         if (curY < 0 || curY >= altSprite.height()) continue;
 
-        altSprite.drawWideLine(2, curY, 2 + markerWidth, curY, 1, TFT_WHITE);
+        AltTape::drawMark(altSprite, curY);
+        OVERDRAW_RECT(altSprite, 2, curY, ALT_TAPE_MARK_WIDTH + 1, 1);
         if (alt % 500 == 0) {
-            sprintf(buf, "%03d", abs(alt) / 100); // absolute value — NEG indicator handles sign
-            altSprite.drawString(buf, 10, curY + 2);
+            AltTape::drawLabel(altSprite, alt, curY);
+            OVERDRAW_TEXT(altSprite, "000", 10, curY + 2);
         }
     }
-
-    alt100Sprite.pushSprite(0, ATT_HORIZON - alt100Sprite.height() / 2 - 1);
-    altSprite.pushSprite(ALT_LEFT_EDGE - 2, ATT_TOP_EDGE);
-
-    return;
 }
 
-void CC_ISIS::drawBackground()
+// The fixed overlays on top of the attitude: yellow markers, roll arc and the
+// blackout arcs. Compiled into staticOverlay at boot; drawn directly only if that failed.
+void CC_ISIS::drawStaticOverlays()
 {
     // Draw the yellow background markers.
     // bgSprite.pushSprite(0, ATT_TOP_EDGE + ATT_HORIZON + 33, TFT_MAGENTA);  // 33 is tip of pointer from top of bgSprite
 
     attSprite.pushImage(2, ATT_HORIZON - 23, ATTBACKGROUND_IMG_WIDTH, ATTBACKGROUND_IMG_HEIGHT, ATTBACKGROUND_IMG_DATA, 8184);
     attSprite.pushImage(6, 4, ROLLARC_IMG_WIDTH, ROLLARC_IMG_HEIGHT, ROLLARC_IMG_DATA, 8184);
+    OVERDRAW_RECT(attSprite, 2, ATT_HORIZON - 23, ATTBACKGROUND_IMG_WIDTH, ATTBACKGROUND_IMG_HEIGHT);
+    OVERDRAW_RECT(attSprite, 6, 4, ROLLARC_IMG_WIDTH, ROLLARC_IMG_HEIGHT);
+
+    drawBlackoutArcs();
+}
 
-    // Draw the curves top and bottom of the gauge.
+// The curves top and bottom of the gauge.
+void CC_ISIS::drawBlackoutArcs()
+{
     blackoutArcSprite.pushSprite(0, 0, TFT_MAGENTA);
-    attSprite.setPivot(attSprite.width() / 2, attSprite.height() - blackoutArcSprite.height() / 2);
-    blackoutArcSprite.pushRotated(180.0f, TFT_MAGENTA);
+    OVERDRAW_RECT(attSprite, 0, 0, blackoutArcSprite.width(), blackoutArcSprite.height());
+    blitRotated(surfaceOf(attSprite), surfaceOf(blackoutArcSprite), blackoutArcSprite.getPivotX(), blackoutArcSprite.getPivotY(),
+                attSprite.width() / 2, attSprite.height() - blackoutArcSprite.height() / 2, 180.0f, pixelColor(TFT_MAGENTA));
+}
+
+// Compile drawStaticOverlays() into one run-length layer, using attSprite as the canvas.
+// Anything drawn over two different solid colours that came out different both
+// times is transparent.
+//
+// The blackout arcs are compiled into attMask instead: the visible span of each
+// row. The attitude is clipped to it, so the arcs are drawn here once and stay.
+void CC_ISIS::buildStaticOverlay()
+{
+    const int32_t w     = attSprite.width();
+    const size_t  len   = attSprite.bufferLength();
+    const size_t  count = len / sizeof(Pixel);
+    Pixel        *first = (Pixel *)ps_malloc(len);
+    if (!first) return;
+    const Pixel *canvas = (const Pixel *)attSprite.getBuffer();
+
+    attSprite.fillSprite(TFT_BLACK);
+    drawBlackoutArcs();
+    memcpy(first, canvas, len);
+    attSprite.fillSprite(TFT_WHITE);
+    drawBlackoutArcs();
+
+    for (int32_t y = 0; y < attSprite.height(); y++) {
+        int32_t x0 = -1, x1 = 0;
+        for (int32_t x = 0; x < w; x++) {
+            if (first[y * w + x] == canvas[y * w + x]) continue;
+            if (x0 < 0) x0 = x;
+            x1 = x + 1;
+        }
+        attVisible[y] = { (int16_t)(x0 < 0 ? 0 : x0), (int16_t)x1 };
+    }
+
+    attSprite.fillSprite(TFT_BLACK);
+    drawStaticOverlays();
+    memcpy(first, canvas, len);
+    attSprite.fillSprite(TFT_WHITE);
+    drawStaticOverlays();
+
+    // Transparent pixels get a colour no opaque pixel uses. Masked pixels are left to the arcs.
+    const uint32_t colors = 1UL << (8 * sizeof(Pixel));
+    uint8_t       *used   = (uint8_t *)calloc(colors / 8, 1);
+    uint32_t       key    = colors;
+    if (used) {
+        for (size_t i = 0; i < count; i++)
+            if (first[i] == canvas[i]) used[first[i] / 8] |= 1 << (first[i] % 8);
+        key = 0;
+        while (key < colors && (used[key / 8] & (1 << (key % 8)))) key++;
+        free(used);
+    }
+
+    if (key < colors) {
+        for (size_t i = 0; i < count; i++) {
+            const RowSpan &span = attVisible[i / w];
+            int32_t        x    = i % w;
+            if (first[i] != canvas[i] || x < span.x0 || x >= span.x1) first[i] = key;
+        }
+        if (staticOverlay.encode(first, w, attSprite.height(), w, (Pixel)key)) attMask = attVisible;
+    }
+    free(first);
+
+    attSprite.fillSprite(TFT_BLACK);
+    drawBlackoutArcs();
+}
+
+// The overlays in band; drawn directly (no overlay compiled) they cover the whole attitude.
+void CC_ISIS::drawBackground(const AttBand &band)
+{
+    if (staticOverlay.valid())
+        staticOverlay.draw(band.target, 0, -band.top);
+    else
+        drawStaticOverlays();
 }
 
 void CC_ISIS::drawPressure()
 {
-    kohlsSprite.fillSprite(TFT_BLACK);
-    kohlsSprite.setTextColor(TFT_BLUE);
-    if (isisState.isStdPressure) {
-        kohlsSprite.setTextSize(1.2);
-        kohlsSprite.drawString("STD", 1, 1);
-    } else {
-        kohlsSprite.setTextSize(1.0);
-        kohlsSprite.drawNumber(isisState.mbPressure, 1, 1);
+    char text[12];
+    if (isisState.isStdPressure)
+        strcpy(text, "STD");
+    else
+        DigitFont::formatInt(text, isisState.mbPressure);
+
+    LGFX_Sprite &sprite = pressureReadout.sprite();
+    if (pressureReadout.update(text)) {
+        sprite.fillSprite(TFT_BLACK);
+        OVERDRAW_RECT(sprite, 0, 0, sprite.width(), sprite.height());
+        if (pressureDigits.enabled && pressureDigits.valid() && stdDigits.valid()) {
+            (isisState.isStdPressure ? stdDigits : pressureDigits).drawString(surfaceOf(sprite), text, 1, 1);
+        } else {
+            sprite.setTextColor(TFT_BLUE);
+            sprite.setTextSize(isisState.isStdPressure ? 1.2 : 1.0);
+            sprite.drawString(text, 1, 1);
+            OVERDRAW_TEXT(sprite, text, 1, 1);
+        }
+    }
+    pressureReadout.setTarget(framePresenter.target(), QNH_LEFT_EDGE, READOUT_TOP_EDGE, true);
+    if (pressureReadout.push()) {
+        framePresenter.damage(QNH_LEFT_EDGE, READOUT_TOP_EDGE, sprite.width(), sprite.height());
+        OVERDRAW_PUSH(sprite);
+        PANEL_BYTES(sprite.bufferLength(), 0);
     }
-    kohlsSprite.pushSprite(140, 420);
+    PANEL_BYTES(0, sprite.bufferLength());
 }
 
 void CC_ISIS::drawMach() {
-    if(isisState.machSpeed < 0.45) {
-        kohlsSprite.fillSprite(TFT_BLACK);
-        kohlsSprite.pushSprite(20, 420); 
-        return;
+    // Blank below M.45; otherwise .49, 1.02
+    char text[8] = "";
+    if (isisState.machSpeed >= 0.45) DigitFont::formatFixed(text, isisState.machSpeed, 2, true);
+
+    LGFX_Sprite &sprite = machReadout.sprite();
+    if (machReadout.update(text)) {
+        sprite.fillSprite(TFT_BLACK);
+        OVERDRAW_RECT(sprite, 0, 0, sprite.width(), sprite.height());
+        if (machDigits.enabled && machDigits.valid()) {
+            machDigits.drawString(surfaceOf(sprite), text, 1, 1);
+        } else if (text[0]) {
+            sprite.setTextColor(TFT_GREEN);
+            sprite.setTextSize(1.0);
+            sprite.drawString(text, 1, 1);
+            OVERDRAW_TEXT(sprite, text, 1, 1);
+        }
+    }
+    machReadout.setTarget(framePresenter.target(), MACH_LEFT_EDGE, READOUT_TOP_EDGE, true);
+    if (machReadout.push()) {
+        framePresenter.damage(MACH_LEFT_EDGE, READOUT_TOP_EDGE, sprite.width(), sprite.height());
+        OVERDRAW_PUSH(sprite);
+        PANEL_BYTES(sprite.bufferLength(), 0);
     }
+    PANEL_BYTES(0, sprite.bufferLength());
+}
 
-    char buf[5];
+// Push the damaged parts of sprite, at (x, y) on the frame, and clear damage.
+void CC_ISIS::present(LGFX_Sprite &sprite, int32_t x, int32_t y, Damage &damage)
+{
+    LovyanGFX     *frame         = framePresenter.target();
+    const uint32_t bytesPerPixel = (frame->getColorDepth() + 7) / 8;
+    PANEL_BYTES(0, damage.fullArea() * bytesPerPixel);
+
+    if (!damageTracking) damage.addAll();
+#ifdef ISIS_DAMAGE_OUTLINE
+    DamageOutlines *outlines = nullptr;
+    for (DamageOutlines &o : damageOutlines)
+        if (o.damage == &damage || (!o.damage && !outlines)) outlines = &o;
+    outlines->damage = &damage;
+    for (int i = 0; i < outlines->count; i++) damage.add(outlines->rects[i].x, outlines->rects[i].y, outlines->rects[i].w, outlines->rects[i].h);
+#endif
+    damage.coalesce();
 
-    kohlsSprite.fillSprite(TFT_BLACK);
-    kohlsSprite.setTextColor(TFT_GREEN);
-    kohlsSprite.setTextSize(1.0);
-    sprintf(buf, "%.2f", isisState.machSpeed);
-    char *s = buf;
-    // 2. Remove leading 0 if present (handles 0.49 -> .49)
-    if (s[0] == '0' && s[1] == '.') {
-        s++;
+    for (int i = 0; i < damage.count(); i++) {
+        const DamageRect &r = damage.rect(i);
+        framePresenter.upload(sprite, x, y, r);
+        PANEL_BYTES((uint32_t)r.w * r.h * bytesPerPixel, 0);
+    }
+    OVERDRAW_PUSH(sprite);
+
+#ifdef ISIS_DAMAGE_OUTLINE
+    // Outlined over the pushed pixels, so they show for one frame.
+    framePresenter.fence(sprite);
+    outlines->count = damage.count();
+    for (int i = 0; i < damage.count(); i++) {
+        const DamageRect &r = damage.rect(i);
+        outlines->rects[i]  = r;
+        frame->drawRect(x + r.x, y + r.y, r.w, r.h, TFT_MAGENTA);
     }
-    kohlsSprite.drawString(s, 1, 1);
-    kohlsSprite.pushSprite(20, 420); 
+#endif
+    damage.clear();
 }
+
+// The attitude drawn in place in the back buffer: only mark its damage for the flip.
+void CC_ISIS::presentInPlace(int32_t x, int32_t y, Damage &damage)
+{
+    PANEL_BYTES(0, damage.fullArea() * sizeof(Pixel));
+    if (!damageTracking) damage.addAll();
+    damage.coalesce();
+#ifdef ISIS_DAMAGE_OUTLINE
+    // Last frame's outlines are only on the panel: flip their rectangles again to paint them over.
+    for (int i = 0; i < inPlaceOutlines.count; i++) {
+        const DamageRect &o = inPlaceOutlines.rects[i];
+        framePresenter.damage(o.x, o.y, o.w, o.h);
+    }
+    inPlaceOutlines.count = damage.count();
+#endif
+    for (int i = 0; i < damage.count(); i++) {
+        const DamageRect &r = damage.rect(i);
+        framePresenter.damage(x + r.x, y + r.y, r.w, r.h);
+#ifdef ISIS_DAMAGE_OUTLINE
+        inPlaceOutlines.rects[i] = DamageRect{ (int16_t)(x + r.x), (int16_t)(y + r.y), r.w, r.h };
+#endif
+    }
+    damage.clear();
+}
+
+// Draw the attitude straight into the back buffer when everything drawn on it this frame goes
+// through attTarget: the background from the compiled overlay, the altitude counter from the
+// drums, and no NEG letters. That saves writing it to attSprite and copying it across.
+bool CC_ISIS::chooseAttTarget(bool isNeg)
+{
+    bool direct = attDirectEnabled && staticOverlay.valid() && !isNeg && altDrumsUsable(fabsf(isisState.altitude));
+#ifdef ISIS_OVERDRAW
+    direct = false; // overdraw is counted on the sprites
+#endif
+    const PixelSurface frame = direct ? framePresenter.surface(ATT_LEFT_EDGE, ATT_TOP_EDGE, ATT_WIDTH, ATT_HEIGHT) : PixelSurface();
+    direct                   = frame.pixels != nullptr;
+
+    if (direct && !attDirect) {
+        // Outside attMask nothing is drawn again but in attSprite: take that across first.
+        framePresenter.upload(attSprite, ATT_LEFT_EDGE, ATT_TOP_EDGE, DamageRect{ 0, 0, ATT_WIDTH, ATT_HEIGHT });
+        framePresenter.fence(attSprite);
+    }
+    if (direct != attDirect) attDamage.addAll();
+    attDirect = direct;
+    attTarget = direct ? frame : surfaceOf(attSprite);
+    return direct;
+}
+
 void CC_ISIS::draw()
 {
-    drawAttitude();
-    drawBackground();
-    drawSpeedTape();
-    drawAltTape(); // NOTE: Alt tape writes on the attSprite.
-    attSprite.pushSprite(ATT_LEFT_EDGE, ATT_TOP_EDGE);
-    drawPressure();
-    drawMach();
+    PERF_SCOPE(perfStats.frame);
+#ifdef ISIS_PERF_STATS
+    uint32_t pixels = blitPixelsWritten();
+#endif
+    // powerStateSet() clears the panel when the power comes back.
+    if (panelDirty || isisState.forceRedraw) {
+        speedDamage.addAll();
+        altDamage.addAll();
+        attDamage.addAll();
+        pressureReadout.invalidate();
+        machReadout.invalidate();
+        panelDirty            = false;
+        isisState.forceRedraw = false;
+        frameScheduler.drawAll();
+    }
+
+    if (frameScheduler.due(LAYER_ATTITUDE)) {
+        // attSprite is drawn over every frame, but only changes with these (and the altitude, below).
+        const bool isNeg = isisState.altitude < 0.0f;
+        if (isisState.pitchAngle != panelPitch || isisState.bankAngle != panelBank || isisState.ballPos != panelBall || isNeg != panelNeg) {
+            attDamage.addAll();
+            panelPitch = isisState.pitchAngle;
+            panelBank  = isisState.bankAngle;
+            panelBall  = isisState.ballPos;
+            panelNeg   = isNeg;
+        }
+        // Nothing is drawn in a sprite while it is still being uploaded.
+        framePresenter.fence(attSprite);
+        if (chooseAttTarget(isNeg)) attDirectFrames++;
+        bool banded = false;
+#ifdef ISIS_ATT_BANDS_BUILD
+        if (attBandsUsable()) {
+            PERF_SCOPE(perfStats.attitude); // and the background, each band drawing its part of both
+            updateSlip();
+            attBands.draw(drawAttBand, this);
+            banded = true;
+        }
+#endif
+        if (!banded) {
+            {
+                PERF_SCOPE(perfStats.attitude);
+                OVERDRAW_STAGE("attitude");
+                drawAttitude();
+            }
+            {
+                PERF_SCOPE(perfStats.background);
+                OVERDRAW_STAGE("background");
+                drawBackground();
+            }
+        }
+#ifdef ISIS_PERF_STATS
+        perfStats.attitudePixels.add(blitPixelsWritten() - pixels);
+#endif
+    }
+    if (frameScheduler.due(LAYER_SPEED)) {
+        PERF_SCOPE(perfStats.speedTape);
+        OVERDRAW_STAGE("speedTape");
+        framePresenter.fence(speedSprite);
+        drawSpeedTape();
+    }
+    if (frameScheduler.due(LAYER_ATTITUDE)) {
+        {
+            PERF_SCOPE(perfStats.altTape);
+            OVERDRAW_STAGE("altTape");
+            framePresenter.fence(altSprite);
+            drawAltTape(); // NOTE: Alt tape writes on the attSprite.
+        }
+        if (attDirect)
+            presentInPlace(ATT_LEFT_EDGE, ATT_TOP_EDGE, attDamage);
+        else
+            present(attSprite, ATT_LEFT_EDGE, ATT_TOP_EDGE, attDamage);
+    }
+    {
+        PERF_SCOPE(perfStats.readouts);
+        if (frameScheduler.due(LAYER_QNH)) {
+            OVERDRAW_STAGE("pressure");
+            drawPressure();
+        }
+        if (frameScheduler.due(LAYER_MACH)) {
+            OVERDRAW_STAGE("mach");
+            drawMach();
+        }
+    }
+#ifdef ISIS_OVERDRAW
+    overdraw.endFrame();
+#endif
+#ifdef ISIS_PERF_STATS
+    perfStats.panelBytes.add(panelBytes);
+    perfStats.panelBytesFull.add(panelBytesFull);
+    panelBytes = panelBytesFull = 0;
+#endif
+}
+
+#ifdef ISIS_ATT_BANDS_BUILD
+// One band of the attitude and its overlays, on whichever core attBands gave it to.
+void CC_ISIS::drawAttBand(void *isis, int32_t top, int32_t bottom)
+{
+    const AttBand band = attBand(top, bottom);
+    ((CC_ISIS *)isis)->drawAttitudeBand(band);
+    ((CC_ISIS *)isis)->drawBackground(band);
+}
+#endif
+
+#ifdef ISIS_OVERDRAW
+void CC_ISIS::reportOverdraw()
+{
+    uint32_t frames = max(overdraw.frames(), (uint32_t)1);
+    for (int i = 0; i < overdraw.stageCount(); i++) {
+        OverdrawStats::Counts c = overdraw.stageCounts(i);
+        perfStatus("od %s: %lu px/frame, %lu overdrawn", overdraw.stageName(i), (unsigned long)(c.written / frames), (unsigned long)(c.overdrawn / frames));
+    }
+    for (int i = 0; i < overdraw.surfaceCount(); i++) {
+        OverdrawStats::Counts c = overdraw.surfaceCounts(i);
+        perfStatus("od %sSprite: %lu px/frame, %lu overdrawn", overdraw.surfaceName(i), (unsigned long)(c.written / frames), (unsigned long)(c.overdrawn / frames));
+    }
+    overdraw.resetCounts();
+}
+#endif
+
+#ifdef ISIS_PERF_STATS
+void CC_ISIS::reportStats()
+{
+    perfStatus("frame avg %luus max %lu (%lu frames)", perfStats.frame.avg(), perfStats.frame.max, perfStats.frame.count);
+    perfStatus("att %lu bg %lu spd %lu alt %lu txt %lu", perfStats.attitude.avg(), perfStats.background.avg(),
+               perfStats.speedTape.avg(), perfStats.altTape.avg(), perfStats.readouts.avg());
+
+    // Drawn and flipped, as the scheduler timed them.
+    const PerfHistogram &frameTime = frameScheduler.frameTime;
+    perfStatus("frame time p50 %lu p90 %lu p99 %lu max %luus", frameTime.percentile(50), frameTime.percentile(90),
+               frameTime.percentile(99), frameTime.max);
+    const unsigned long periodUs = frameScheduler.periodUs();
+    perfStatus("pacing: %lu fps, interval p50 %lu p99 %luus, jitter avg %lu max %luus, %lu dropped",
+               periodUs ? 1000000 / periodUs : 0, frameScheduler.interval.percentile(50), frameScheduler.interval.percentile(99),
+               frameScheduler.jitter.avg(), frameScheduler.jitter.max, frameScheduler.dropped);
+    char   layers[80] = "";
+    size_t length = 0;
+    for (int i = 0; i < frameScheduler.layerCount() && length < sizeof(layers); i++)
+        length += snprintf(layers + length, sizeof(layers) - length, " %s %lu", frameScheduler.layer(i).name, frameScheduler.layerFrames[i]);
+    perfStatus("layers drawn of %lu frames:%s", frameScheduler.frames, layers);
+
+    perfStatus("labels: %s, %d entries %u bytes, rendered at boot in %lums", ladderLabels.enabled ? "cached" : "drawn",
+               ladderLabels.entries(), (unsigned)ladderLabels.bytes(), ladderLabels.fillUs() / 1000);
+    perfStatus("slip: %lu rebuilt %lu reused", _slipRebuilds, _slipReuses);
+    perfStatus("alt labels: %lu/%lu hit %d entries %u bytes", altTape.hits, altTape.hits + altTape.misses, altTape.entries(),
+               (unsigned)altTape.bytes());
+    perfStatus("tapes scrolled/redrawn: speed %lu/%lu alt %lu/%lu", speedScrolls, speedRedraws, altTape.scrolls, altTape.redraws);
+    perfStatus("readouts pushed/skipped: qnh %lu/%lu mach %lu/%lu", pressureReadout.pushes, pressureReadout.skips, machReadout.pushes,
+               machReadout.skips);
+    perfStatus("panel: %lu bytes/frame pushed, %lu if pushed whole", perfStats.panelBytes.avg(), perfStats.panelBytesFull.avg());
+    perfStatus("overlay: %u bytes, attitude %lu px/frame", (unsigned)staticOverlay.bytes(), perfStats.attitudePixels.avg());
+    perfStatus("attitude drawn in the back buffer %lu/%lu frames", attDirectFrames, perfStats.frame.count);
+    attDirectFrames = 0;
+#ifdef ISIS_ATT_BANDS_BUILD
+    if (attBands.elapsed.count) {
+        const unsigned long speedup = attBands.speedup();
+        perfStatus("bands: %lu/%lu frames, split at row %lu, speedup %lu.%02lux", attBands.elapsed.count,
+                   perfStats.frame.count, attBands.bandRows.avg(), speedup / 100, speedup % 100);
+        perfStatus("bands: top %luus bottom %lu, imbalance avg %lu max %lu", attBands.here.avg(), attBands.there.avg(),
+                   attBands.imbalance.avg(), attBands.imbalance.max);
+    }
+    attBands.resetStats();
+#endif
+    perfStatus("present %s: latency avg %luus max %lu, copy %lu", framePresenter.doubleBuffered() ? "double" : "single",
+               framePresenter.latency.avg(), framePresenter.latency.max, framePresenter.copyTime.avg());
+    perfStatus("present: %lu flips, %lu missed vsyncs, %lu late, %lu timeouts", framePresenter.flips, framePresenter.missedVsyncs,
+               framePresenter.lateCopies, framePresenter.timeouts);
+
+    static FramePresenter::PanelCounts lastPanel = {};
+    const FramePresenter::PanelCounts  panel     = framePresenter.panelCounts();
+    perfStatus("panel %lu kHz: %lu refreshes, %lu underruns, drift %ld ppm", (unsigned long)(lcd._bus_instance.config().freq_write / 1000),
+               (unsigned long)(panel.intervals - lastPanel.intervals), (unsigned long)(panel.underruns - lastPanel.underruns),
+               (long)framePresenter.driftPpm(lastPanel, panel));
+    lastPanel = panel;
+
+    perfStatus("uploads %s: %luus/frame on core 0, %lu waited for, %lu overlapped", framePresenter.asyncUploads ? "async" : "sync",
+               framePresenter.uploadTime.avg(), framePresenter.uploadWait.avg(),
+               framePresenter.uploadTime.avg() - min(framePresenter.uploadWait.avg(), framePresenter.uploadTime.avg()));
+
+#ifdef ISIS_RENDER_TASK
+    static unsigned long lastReportMs = 0, lastPublishes = 0;
+    const unsigned long  elapsedMs    = max(millis() - lastReportMs, 1UL);
+    const unsigned long  publishes    = intakePublishes;
+    perfStatus("render task: %lu fps, %lu frames with new data, %lu published", perfStats.frame.count * 1000 / elapsedMs,
+               freshFrames, publishes - lastPublishes);
+    perfStatus("intake to frame: avg %luus max %lu, %lu snapshot retries", intakeLatency.avg(), intakeLatency.max,
+               (unsigned long)snapshotRetries);
+    perfStatus("commands held back since boot: %lu merged, %lu dropped", (unsigned long)commandsMerged, (unsigned long)commandsDropped);
+    lastReportMs    = millis();
+    lastPublishes   = publishes;
+    freshFrames     = 0;
+    snapshotRetries = 0;
+    intakeLatency   = PerfSample();
+#endif
+
+    perfStats.reset();
+    framePresenter.resetStats();
+    frameScheduler.resetStats();
 }
+#endif
 
 void CC_ISIS::updateInputValues()
 {
@@ -604,11 +1788,67 @@ void CC_ISIS::updateInputValues()
 }
 
 void CC_ISIS::update()
+{
+#ifdef ISIS_RENDER_TASK
+    if (renderTaskHandle) {
+        if (intakeDirty) publishIntake();
+        if (heldCount) sendHeldCommands();
+        perfStatusFlush();
+        settingsFlush();
+        return;
+    }
+#endif
+    // Between frames the loop goes back to the messages.
+    if (frameScheduler.untilDue()) return;
+    renderFrame();
+}
+
+void CC_ISIS::renderFrame()
 {
     // static unsigned long lastDelta = 0;
 
+#ifdef ISIS_RENDER_TASK
+    if (renderTaskHandle) takeIntake();
+#endif
+
+#ifdef ISIS_BENCHMARK
+    static bool benchmarked = false;
+    if (!benchmarked && millis() > ISIS_BENCHMARK_DELAY_MS) {
+        benchmarked = true;
+        runBenchmarks();
+#ifdef ISIS_OVERDRAW
+        overdraw.resetCounts();
+#endif
+    }
+#endif
+
+    frameScheduler.startFrame();
     updateInputValues();
+#ifdef ISIS_PALETTE
+    updatePalette();
+#endif
     draw();
+    framePresenter.flip();
+#ifdef ISIS_DAMAGE_OUTLINE
+    drawInPlaceOutlines();
+#endif
+    frameScheduler.endFrame();
+
+#ifdef ISIS_OVERDRAW
+    static unsigned long lastOverdrawReport = 0;
+    if (millis() - lastOverdrawReport > ISIS_STATS_INTERVAL_MS) {
+        lastOverdrawReport = millis();
+        reportOverdraw();
+    }
+#endif
+
+#ifdef ISIS_PERF_STATS
+    static unsigned long lastReport = 0;
+    if (millis() - lastReport > ISIS_STATS_INTERVAL_MS) {
+        lastReport = millis();
+        reportStats();
+    }
+#endif
 
     /*
     char buf[80];
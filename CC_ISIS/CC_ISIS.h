@@ -2,9 +2,52 @@
 
 #include "Arduino.h"
 #include "ISISCommon.h"
+#include "ISISBlit.h"
+#include "ISISDamage.h"
+
+// The attitude texture is built for -DISIS_ADI_TEXTURE, and for the benchmarks so they can compare both engines.
+#if defined(ISIS_ADI_TEXTURE) || defined(ISIS_BENCHMARK)
+#define ISIS_ADI_TEXTURE_BUILD
+#endif
+
+// Likewise the attitude bands (ISISBands.h), drawn with -DISIS_ATT_BANDS.
+#if defined(ISIS_ATT_BANDS) || defined(ISIS_BENCHMARK)
+#define ISIS_ATT_BANDS_BUILD
+#endif
 
 #define PRESS_COLOR TFT_BLUE
 
+#define ATT_LEFT_EDGE 76
+#define ATT_TOP_EDGE  56
+#define ATT_HORIZON   194
+#define ALT_LEFT_EDGE 398
+#define ATT_WIDTH     320
+#define ATT_HEIGHT    350
+
+#define QNH_LEFT_EDGE    140 // readouts below the attitude
+#define MACH_LEFT_EDGE   20
+#define READOUT_TOP_EDGE 420
+
+#define SPEED_TAPE_MAX     450 // kt, top of the pre-rendered speed strip
+#define SPEED_MARK_SPACING 19  // px per 5 kt (3.8 px/kt)
+#define SPEED_STRIP_MARGIN 16  // rows above the top / below the bottom mark for its number
+
+// Sprites live in CC_ISIS.cpp. Declared here for the benchmark code.
+extern LGFX_Sprite attSprite;
+
+// The layers the frame scheduler (ISISSchedule.h) draws each at its own rate, in the order of
+// CC_ISIS.cpp's FRAME_LAYERS.
+enum FrameLayer { LAYER_ATTITUDE, LAYER_SPEED, LAYER_QNH, LAYER_MACH };
+
+// Rows [top, bottom) of the attitude, where its stages draw: attTarget's rows as a surface of their
+// own and attMask from row top. A stage draws at row y - top what it would draw at row y.
+struct AttBand {
+    PixelSurface   target;
+    const RowSpan *mask;
+    int32_t        top;
+};
+AttBand attBand(int32_t top = 0, int32_t bottom = ATT_HEIGHT);
+
 class CC_ISIS : public CC_ISIS_Base
 {
 public:
@@ -19,18 +62,88 @@ public:
 private:
     bool _initialized;
 
+    // The slip ball's column in slipSprite (-1: draw it again), and how often updateSlip() moved it or not.
+    int16_t       _slipBallX    = -1;
+    unsigned long _slipRebuilds = 0;
+    unsigned long _slipReuses   = 0;
+
+    void apply(int16_t messageID, char *setPoint);
+    void renderFrame();
+#ifdef ISIS_RENDER_TASK
+    void        startRenderTask();
+    static void renderTask(void *arg);
+    void        takeIntake();
+#endif
+
     void setupSprites();
     void updateInputValues();
-    void drawBackground();
+    void drawBackground(const AttBand &band = attBand());
+    void drawStaticOverlays();
+    void drawBlackoutArcs();
+    void buildStaticOverlay();
     void drawPressure();
     void drawSpeedTape();
+    void drawSpeedTapeDirect();
+    void buildSpeedStrip();
     void drawAltTape();
+    void drawAltTapeDirect(float curAlt);
+    void drawAltCounter(float curAlt);
+    void drawAltCounterDirect(float curAlt);
+    void buildAltDrums();
+    void drawHorizonFill(const AttBand &band = attBand());
+    void drawPitchLadder(const AttBand &band = attBand());
+    void updateSlip();
+    void drawRollPointer(const AttBand &band = attBand());
+    void drawHorizonLine(const AttBand &band = attBand());
     void drawAttitude();
+    void drawAttitudeBand(const AttBand &band);
     void drawMach();
     void drawLS();
 
     void draw();
+    void present(LGFX_Sprite &sprite, int32_t x, int32_t y, Damage &damage);
+    void presentInPlace(int32_t x, int32_t y, Damage &damage);
+    bool chooseAttTarget(bool isNeg);
+#ifdef ISIS_ATT_BANDS_BUILD
+    static void drawAttBand(void *isis, int32_t top, int32_t bottom);
+#endif
+
+#ifdef ISIS_ADI_TEXTURE_BUILD
+    void buildAdiTexture();
+    void drawAttitudeTexture(const AttBand &band = attBand());
+#endif
+
+#ifdef ISIS_PERF_STATS
+    void reportStats();
+#endif
 
+#ifdef ISIS_OVERDRAW
+    void reportOverdraw();
+#endif
 
+#ifdef ISIS_BENCHMARK
+    // CC_ISIS_Bench.cpp
+    void runBenchmarks();
+    void drawHorizonFillLegacy();
+    void benchHorizonFill();
+    void benchLadderLabels();
+    void benchAdiTexture();
+    void benchRotatedBlit();
+    void benchSlipComposite();
+    void benchBackground();
+    void benchMask();
+    void benchSpeedTape();
+    void benchAltTape();
+    void benchAltCounter();
+    void benchTapeScroll();
+    void benchReadouts();
+    void benchAtlasFonts();
+    void benchDirectAttitude();
+    void benchColorDepth();
+    void benchPalette();
+    void benchSnapshot();
+    void benchAttBands();
+    void benchFramePacing();
+#endif
 
-};
\ No newline at end of file
+};
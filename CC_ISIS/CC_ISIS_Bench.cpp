@@ -0,0 +1,1218 @@
+// Boot-time render benchmarks. Only built with -DISIS_BENCHMARK.
+//
+// Each benchmark sweeps the flight envelope, times the old and new version of
+// a render path on the real sprites, and checks the new one produces the
+// same pixels. Results are reported over kStatus.
+
+#ifdef ISIS_BENCHMARK
+
+#include "CC_ISIS.h"
+#include "ISISAdiTexture.h"
+#include "ISISAtlasFont.h"
+#include "ISISAltTape.h"
+#include "ISISBands.h"
+#include "ISISBlit.h"
+#include "ISISDigitDrum.h"
+#include "ISISDigitFont.h"
+#include "ISISLabelCache.h"
+#include "ISISPalette.h"
+#include "ISISPerf.h"
+#include "ISISPresent.h"
+#include "ISISReadout.h"
+#include "ISISSchedule.h"
+#include "ISISSnapshot.h"
+#include "Images/isisFont.h"
+#include "Images/isisFontAtlas.h"
+#include "Sprites/rollPointer.h"
+#include "Sprites/rollSlip.h"
+
+extern PitchLabelCache ladderLabels;
+extern AdiTexture      adiTexture;
+extern LGFX_Sprite     slipSprite;
+extern LGFX_Sprite     ladderValSprite;
+extern LGFX_Sprite     blackoutArcSprite;
+extern LGFX_Sprite     speedSprite;
+extern LGFX_Sprite     speedStrip;
+extern int32_t         speedStripTop;
+extern unsigned long   speedScrolls;
+extern LGFX_Sprite     altSprite;
+extern LGFX_Sprite     altLabelSprite;
+extern AltTape         altTape;
+extern LGFX_Sprite     alt100Sprite;
+extern DigitDrum       altThousandsDrum;
+extern Readout         pressureReadout;
+extern Readout         machReadout;
+extern bool            panelDirty;
+extern DigitFont       pressureDigits;
+extern DigitFont       stdDigits;
+extern DigitFont       machDigits;
+extern RunImage        staticOverlay;
+extern const RowSpan  *attMask;
+extern PixelSurface    attTarget;
+extern bool            attDirect;
+extern uint32_t        bootRamBytes;
+extern uint32_t        bootPsramBytes;
+extern BandRenderer    attBands;
+extern FrameScheduler  frameScheduler;
+
+// The per-column sky/ground fill drawAttitude() used before fillHorizon(), kept as the reference.
+void CC_ISIS::drawHorizonFillLegacy()
+{
+    const int16_t CENTER_X = attSprite.width() / 2;
+    const int16_t CENTER_Y = ATT_HORIZON - 2;
+
+    const uint16_t SKY_COLOR = TFT_BLUE;
+    const uint16_t GND_COLOR = 37316;
+
+    float bankRad  = isisState.bankAngle * PIf / 180.0f;
+    bool  inverted = (isisState.bankAngle > 90.0 || isisState.bankAngle < -90.0);
+
+    float horizonPixelOffset = inverted ? (isisState.pitchAngle * 8.0f) : (-isisState.pitchAngle * 8.0f);
+
+    attSprite.fillSprite(SKY_COLOR);
+
+    float tanBank        = tan(bankRad);
+    float cosBank        = cos(bankRad);
+    float safeCosBank    = (fabsf(cosBank) < 0.01f) ? (cosBank < 0.0f ? -0.01f : 0.01f) : cosBank;
+    float horizonCenterY = CENTER_Y + horizonPixelOffset / safeCosBank;
+
+    for (int16_t x = 0; x < attSprite.width(); x++) {
+        int16_t dx           = x - CENTER_X;
+        float   horizonY     = horizonCenterY + (dx * tanBank);
+        int16_t horizonPixel = round(horizonY);
+        if (horizonPixel < attSprite.height()) {
+            attSprite.drawFastVLine(x, max((int16_t)0, horizonPixel), ATT_HEIGHT - max((int16_t)0, horizonPixel), GND_COLOR);
+        }
+    }
+}
+
+// Sky/ground fill: per-column drawFastVLine vs row spans, bank -180..180, pitch -90..90.
+void CC_ISIS::benchHorizonFill()
+{
+    const size_t len       = attSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench fill: no memory");
+        return;
+    }
+
+    PerfSample legacy, spans;
+    int        mismatched = 0;
+    int        skipped    = 0;
+
+    for (int bank = -180; bank <= 180; bank += 10) {
+        for (int pitch = -90; pitch <= 90; pitch += 10) {
+            isisState.bankAngle  = bank;
+            isisState.pitchAngle = pitch;
+
+            // Near 90° bank the old loop overflows its int16_t horizon row, so there
+            // is no sensible reference to compare against. Time it, don't check it.
+            float bankRad = bank * PIf / 180.0f;
+            float cosBank = cos(bankRad);
+            float reach   = fabsf(pitch * 8.0f / max(fabsf(cosBank), 0.01f)) + ATT_HORIZON + fabsf(tan(bankRad)) * attSprite.width();
+            bool  check   = reach < 32000.0f;
+
+            unsigned long t0 = micros();
+            drawHorizonFillLegacy();
+            legacy.add(micros() - t0);
+            memcpy(reference, attSprite.getBuffer(), len);
+
+            t0 = micros();
+            drawHorizonFill();
+            spans.add(micros() - t0);
+
+            if (!check)
+                skipped++;
+            else if (memcmp(reference, attSprite.getBuffer(), len) != 0)
+                mismatched++;
+        }
+    }
+
+    free(reference);
+
+    perfStatus("bench fill columns: avg %luus min %lu max %lu", legacy.avg(), legacy.min, legacy.max);
+    perfStatus("bench fill spans:   avg %luus min %lu max %lu", spans.avg(), spans.min, spans.max);
+    perfStatus("bench fill: %lu frames, %d mismatched, %d unchecked", spans.count, mismatched, skipped);
+}
+
+// drawAttitude() frame time in a steady turn: per-frame label render + pushRotated vs the label cache.
+void CC_ISIS::benchLadderLabels()
+{
+    const int FRAMES = 200;
+    if (!ladderLabels.ready()) {
+        perfStatus("bench labels: the cache didn't fit (%d entries)", ladderLabels.entries());
+        return;
+    }
+
+    PerfSample legacy, cached;
+    for (int pass = 0; pass < 2; pass++) {
+        ladderLabels.enabled = (pass > 0);
+        PerfSample &sample   = pass ? cached : legacy;
+
+        // 25° turn with a little wobble, nose slowly moving so the labels scroll.
+        for (int f = 0; f < FRAMES; f++) {
+            isisState.bankAngle  = 25.0f + 0.4f * sinf(f * 0.3f);
+            isisState.pitchAngle = -5.0f + 8.0f * sinf(f * 0.05f);
+
+            unsigned long t0 = micros();
+            drawAttitude();
+            sample.add(micros() - t0);
+        }
+    }
+    ladderLabels.enabled = true;
+
+    perfStatus("bench labels pushRotated: avg %luus max %lu", legacy.avg(), legacy.max);
+    perfStatus("bench labels cache:       avg %luus max %lu", cached.avg(), cached.max);
+    perfStatus("bench labels: %d entries %u bytes, rendered at boot in %lums", ladderLabels.entries(),
+               (unsigned)ladderLabels.bytes(), ladderLabels.fillUs() / 1000);
+}
+
+// Attitude ball: span fill + ladder + horizon line vs one texture sampling pass.
+// Inverted attitudes are timed but not compared, the legacy fill keeps ground at the bottom there.
+void CC_ISIS::benchAdiTexture()
+{
+    if (!adiTexture.valid()) {
+        perfStatus("bench texture: no memory");
+        return;
+    }
+
+    const size_t len       = attSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench texture: no memory");
+        return;
+    }
+
+    PerfSample    legacy, texture;
+    unsigned long diffTotal = 0, diffMax = 0, compared = 0;
+
+    for (int bank = -180; bank <= 180; bank += 15) {
+        for (int pitch = -30; pitch <= 30; pitch += 5) {
+            isisState.bankAngle  = bank + 0.3f;
+            isisState.pitchAngle = pitch + 0.7f;
+
+            unsigned long t0 = micros();
+            drawHorizonFill();
+            drawPitchLadder();
+            drawHorizonLine();
+            legacy.add(micros() - t0);
+            memcpy(reference, attSprite.getBuffer(), len);
+
+            t0 = micros();
+            drawAttitudeTexture();
+            texture.add(micros() - t0);
+
+            // Inverted, drawHorizonFill() moves the horizon the opposite way to pitch from the ladder
+            // (and the texture, which turns the ladder and the ground as one): those frames differ
+            // by the fill, so only timed. The labels match either way up.
+            if (abs(bank) < 90) {
+                const Pixel  *p    = (const Pixel *)attSprite.getBuffer();
+                unsigned long diff = 0;
+                for (size_t i = 0; i < len / sizeof(Pixel); i++)
+                    diff += (p[i] != reference[i]);
+                diffTotal += diff;
+                diffMax = max(diffMax, diff);
+                compared++;
+            }
+        }
+    }
+
+    free(reference);
+
+    perfStatus("bench texture legacy:  avg %luus min %lu max %lu", legacy.avg(), legacy.min, legacy.max);
+    perfStatus("bench texture sampled: avg %luus min %lu max %lu", texture.avg(), texture.min, texture.max);
+    perfStatus("bench texture: %lu frames, diff avg %lu px max %lu px of %u", compared, compared ? diffTotal / compared : 0, diffMax, (unsigned)(len / sizeof(Pixel)));
+}
+
+// LGFX pushRotated vs blitRotated at its three per-frame call sites.
+void CC_ISIS::benchRotatedBlit()
+{
+    const int FRAMES = 100;
+
+    const size_t len       = attSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench rotate: no memory");
+        return;
+    }
+
+    // Sprite contents as drawAttitude() / drawBackground() leave them.
+    isisState.ballPos = 0;
+    updateSlip();
+    drawRollPointer();
+    ladderValSprite.fillSprite(TFT_BLACK);
+    ladderValSprite.drawString("30", 2, ladderValSprite.height() / 2);
+    blackoutArcSprite.pushSprite(0, 0, TFT_MAGENTA);
+
+    const struct {
+        const char  *name;
+        LGFX_Sprite *sprite;
+        int16_t      x, y;
+        uint16_t     key;
+        float        angle, step;
+    } sites[] = {
+        { "slip", &slipSprite, (int16_t)(attSprite.width() / 2 - 12), ATT_HORIZON, TFT_MAGENTA, -60.0f, 1.23f },
+        { "label", &ladderValSprite, 110, 150, TFT_BLACK, -89.0f, 1.79f },
+        { "arc", &blackoutArcSprite, (int16_t)(attSprite.width() / 2), (int16_t)(attSprite.height() - blackoutArcSprite.height() / 2), TFT_MAGENTA, 180.0f, 0.0f },
+    };
+
+    for (const auto &site : sites) {
+        PerfSample    legacy, blit;
+        unsigned long diffTotal = 0;
+
+        for (int f = 0; f < FRAMES; f++) {
+            float angle = site.angle + f * site.step;
+
+            attSprite.fillSprite(TFT_DARKGREY);
+            attSprite.setPivot(site.x, site.y);
+            unsigned long t0 = micros();
+            site.sprite->pushRotated(angle, site.key);
+            legacy.add(micros() - t0);
+            memcpy(reference, attSprite.getBuffer(), len);
+
+            attSprite.fillSprite(TFT_DARKGREY);
+            t0 = micros();
+            blitRotated(surfaceOf(attSprite), surfaceOf(*site.sprite), site.sprite->getPivotX(), site.sprite->getPivotY(), site.x, site.y,
+                        angle, pixelColor(site.key));
+            blit.add(micros() - t0);
+
+            const Pixel *p = (const Pixel *)attSprite.getBuffer();
+            for (size_t i = 0; i < len / sizeof(Pixel); i++)
+                diffTotal += (p[i] != reference[i]);
+        }
+
+        perfStatus("bench rotate %s: pushRotated avg %luus max %lu, blit avg %luus max %lu, diff avg %lu px", site.name, legacy.avg(),
+                   legacy.max, blit.avg(), blit.max, diffTotal / FRAMES);
+    }
+
+    free(reference);
+}
+
+// Roll pointer in a replayed wobbly turn: full slipSprite rebuild from the RGB565
+// images every frame vs the cached composite that only redraws a moved ball.
+void CC_ISIS::benchSlipComposite()
+{
+    const int FRAMES = 500;
+
+    PerfSample legacy, cached;
+    for (int pass = 0; pass < 2; pass++) {
+        unsigned long rebuilds = _slipRebuilds, reuses = _slipReuses;
+
+        for (int f = 0; f < FRAMES; f++) {
+            // Ball drifting slowly with sim noise on top.
+            isisState.bankAngle = 20.0f + 2.0f * sinf(f * 0.05f);
+            isisState.ballPos   = 0.15f * sinf(f * 0.02f) + 0.002f * ((f * 7919) % 11 - 5);
+
+            unsigned long t0 = micros();
+            if (pass == 0) {
+                slipSprite.fillSprite(TFT_MAGENTA);
+                slipSprite.pushImage(slipSprite.width()/2 - ROLLPOINTER_IMG_WIDTH/2, 0, ROLLPOINTER_IMG_WIDTH, ROLLPOINTER_IMG_HEIGHT, ROLLPOINTER_IMG_DATA, 8184);
+                slipSprite.pushImage(min((int)(slipSprite.width() - ROLLSLIP_IMG_WIDTH),  max(0, (int)(slipSprite.width()/2 - ROLLSLIP_IMG_WIDTH/2 + (0.7 * isisState.ballPos)*ROLLSLIP_IMG_WIDTH))), ROLLPOINTER_IMG_HEIGHT, ROLLSLIP_IMG_WIDTH, ROLLSLIP_IMG_HEIGHT, ROLLSLIP_IMG_DATA, 8184);
+                blitRotated(surfaceOf(attSprite), surfaceOf(slipSprite), slipSprite.getPivotX(), slipSprite.getPivotY(),
+                            attSprite.width()/2 - 12, ATT_HORIZON, isisState.bankAngle, pixelColor(TFT_MAGENTA));
+                legacy.add(micros() - t0);
+            } else {
+                updateSlip();
+                drawRollPointer();
+                cached.add(micros() - t0);
+            }
+        }
+
+        // The full rebuild overwrote the cached ball.
+        _slipBallX = -1;
+
+        if (pass == 1)
+            perfStatus("bench slip: %lu frames, %lu rebuilt %lu reused", cached.count, _slipRebuilds - rebuilds, _slipReuses - reuses);
+    }
+
+    perfStatus("bench slip rebuild: avg %luus max %lu", legacy.avg(), legacy.max);
+    perfStatus("bench slip cached:  avg %luus max %lu", cached.avg(), cached.max);
+}
+
+// drawBackground(): two keyed RGB565 pushImage calls plus both blackout arcs vs the compiled overlay.
+void CC_ISIS::benchBackground()
+{
+    const int FRAMES = 50;
+
+    if (!staticOverlay.valid()) {
+        perfStatus("bench overlay: not compiled");
+        return;
+    }
+
+    const size_t len       = attSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench overlay: no memory");
+        return;
+    }
+
+    // Earlier benchmarks drew over the area the arcs keep.
+    attSprite.fillSprite(TFT_BLACK);
+    drawBlackoutArcs();
+
+    PerfSample legacy, runs;
+    int        mismatched = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        isisState.bankAngle  = -40.0f + f * 1.7f;
+        isisState.pitchAngle = -10.0f + f * 0.4f;
+        drawAttitude();
+
+        memcpy(reference, attSprite.getBuffer(), len);
+        unsigned long t0 = micros();
+        drawStaticOverlays();
+        legacy.add(micros() - t0);
+
+        Pixel *canvas = (Pixel *)attSprite.getBuffer();
+        for (size_t i = 0; i < len / sizeof(Pixel); i++) {
+            Pixel expected = canvas[i];
+            canvas[i]        = reference[i];
+            reference[i]     = expected;
+        }
+
+        t0 = micros();
+        staticOverlay.draw(surfaceOf(attSprite), 0, 0);
+        runs.add(micros() - t0);
+
+        if (memcmp(reference, attSprite.getBuffer(), len) != 0) mismatched++;
+    }
+
+    free(reference);
+
+    perfStatus("bench overlay pushImage: avg %luus max %lu", legacy.avg(), legacy.max);
+    perfStatus("bench overlay runs:      avg %luus max %lu", runs.avg(), runs.max);
+    perfStatus("bench overlay: %d frames, %d mismatched, %u bytes", FRAMES, mismatched, (unsigned)staticOverlay.bytes());
+}
+
+// Attitude frame plus overlays, drawn in full and then covered by the blackout arcs
+// vs clipped to the visible spans with the arcs left in place.
+void CC_ISIS::benchMask()
+{
+    const int FRAMES = 50;
+
+    const RowSpan *mask = attMask;
+    if (!mask) {
+        perfStatus("bench mask: no mask");
+        return;
+    }
+
+    const size_t   len       = attSprite.bufferLength();
+    Pixel         *reference = (Pixel *)ps_malloc(len);
+    const Pixel   *canvas    = (const Pixel *)attSprite.getBuffer();
+    if (!reference) {
+        perfStatus("bench mask: no memory");
+        return;
+    }
+
+    // drawStaticOverlays() goes through LGFX and is not counted, so count its
+    // opaque pixels once: the ones that do not depend on the background.
+    attSprite.fillSprite(TFT_BLACK);
+    drawStaticOverlays();
+    memcpy(reference, canvas, len);
+    attSprite.fillSprite(TFT_WHITE);
+    drawStaticOverlays();
+    unsigned long overlayPixels = 0;
+    for (size_t i = 0; i < len / sizeof(Pixel); i++)
+        overlayPixels += (reference[i] == canvas[i]);
+
+    PerfSample full, masked, fullPixels, maskedPixels;
+    int        mismatched = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        isisState.bankAngle  = -170.0f + f * 6.9f;
+        isisState.pitchAngle = -25.0f + f * 1.1f;
+
+        attMask          = nullptr;
+        uint32_t      p0 = blitPixelsWritten();
+        unsigned long t0 = micros();
+        drawAttitude();
+        drawStaticOverlays();
+        full.add(micros() - t0);
+        fullPixels.add(blitPixelsWritten() - p0 + overlayPixels);
+        memcpy(reference, canvas, len);
+
+        attMask = mask;
+        p0      = blitPixelsWritten();
+        t0      = micros();
+        drawAttitude();
+        drawBackground();
+        masked.add(micros() - t0);
+        maskedPixels.add(blitPixelsWritten() - p0);
+
+        if (memcmp(reference, canvas, len) != 0) mismatched++;
+    }
+    attMask = mask;
+
+    free(reference);
+
+    perfStatus("bench mask full:    avg %luus, %lu px/frame", full.avg(), fullPixels.avg());
+    perfStatus("bench mask clipped: avg %luus, %lu px/frame", masked.avg(), maskedPixels.avg());
+    perfStatus("bench mask: %d frames, %d mismatched", FRAMES, mismatched);
+}
+
+// drawSpeedTape(): marks and numbers drawn every frame vs the window copied from the strip.
+// Rows 0-22 are counted separately: the direct path leaves out the mark just above
+// first20 + 60 even when it is on screen, the strip shows it.
+void CC_ISIS::benchSpeedTape()
+{
+    if (!speedStrip.getBuffer()) {
+        perfStatus("bench speed: no strip");
+        return;
+    }
+
+    const size_t len       = speedSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench speed: no memory");
+        return;
+    }
+
+    const int32_t w      = speedSprite.width();
+    const Pixel  *canvas = (const Pixel *)speedSprite.getBuffer();
+
+    PerfSample    direct, strip;
+    unsigned long topDiff = 0, diff = 0;
+    for (float speed = 20.0f; speed <= SPEED_TAPE_MAX - 80; speed += 0.37f) {
+        isisState.airspeed = speed;
+
+        unsigned long t0 = micros();
+        drawSpeedTapeDirect();
+        direct.add(micros() - t0);
+        memcpy(reference, canvas, len);
+
+        t0            = micros();
+        speedStripTop = INT32_MIN; // the whole window, not a scroll from the direct drawing
+        drawSpeedTape();
+        strip.add(micros() - t0);
+
+        for (size_t i = 0; i < len / sizeof(Pixel); i++) {
+            if (canvas[i] == reference[i]) continue;
+            if (i / w < 23)
+                topDiff++;
+            else
+                diff++;
+        }
+    }
+
+    free(reference);
+
+    perfStatus("bench speed direct: avg %luus max %lu", direct.avg(), direct.max);
+    perfStatus("bench speed strip:  avg %luus max %lu", strip.avg(), strip.max);
+    perfStatus("bench speed: %lu frames, %lu px differ, %lu px in top mark gap", strip.count, diff, topDiff);
+}
+
+// The alt tape marks and labels, drawn one by one vs composed, across the
+// whole range. The hundreds box and digits are not part of this.
+void CC_ISIS::benchAltTape()
+{
+    if (!altTape.valid()) {
+        perfStatus("bench alt: no tape");
+        return;
+    }
+
+    const size_t len       = altSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench alt: no memory");
+        return;
+    }
+
+    const Pixel       *canvas = (const Pixel *)altSprite.getBuffer();
+    const PixelSurface tape   = surfaceOf(altSprite);
+
+    PerfSample    direct, composed;
+    unsigned long diff = 0, framesDiffering = 0;
+    for (float alt = -1000.0f; alt <= 50000.0f; alt += 13.7f) {
+        const float curAlt = fabsf(alt);
+
+        unsigned long t0 = micros();
+        drawAltTapeDirect(curAlt);
+        direct.add(micros() - t0);
+        memcpy(reference, canvas, len);
+
+        t0 = micros();
+        altTape.draw(tape, curAlt);
+        composed.add(micros() - t0);
+
+        unsigned long frameDiff = 0;
+        for (size_t i = 0; i < len / sizeof(Pixel); i++)
+            if (canvas[i] != reference[i]) frameDiff++;
+        diff += frameDiff;
+        if (frameDiff) framesDiffering++;
+    }
+
+    free(reference);
+
+    perfStatus("bench alt direct:   avg %luus max %lu", direct.avg(), direct.max);
+    perfStatus("bench alt composed: avg %luus max %lu", composed.avg(), composed.max);
+    perfStatus("bench alt: %lu frames, %lu differ, %lu px; %d labels %u bytes", composed.count, framesDiffering, diff, altTape.entries(),
+               (unsigned)altTape.bytes());
+}
+
+// The rolling counter from the font vs from the drums: the whole digit box and
+// the thousands box on attSprite. A coarse sweep, then every 9 → 0 rollover
+// that brings in or rolls a new column, in 0.1 ft steps.
+void CC_ISIS::benchAltCounter()
+{
+    if (!altThousandsDrum.valid()) {
+        perfStatus("bench counter: no drums");
+        return;
+    }
+
+    const int32_t boxX = attSprite.width() - 60, boxY = ATT_HORIZON - 20, boxW = 60, boxH = 37;
+    const size_t  len  = alt100Sprite.bufferLength() / sizeof(Pixel);
+    Pixel        *reference = (Pixel *)ps_malloc((len + boxW * boxH) * sizeof(Pixel));
+    if (!reference) {
+        perfStatus("bench counter: no memory");
+        return;
+    }
+
+    const PixelSurface att = surfaceOf(attSprite);
+    const Pixel       *box = (const Pixel *)alt100Sprite.getBuffer();
+    PerfSample         direct, drums;
+    unsigned long      diff = 0, rollFrames = 0, rollDiff = 0;
+
+    auto run = [&](float alt, bool rollover) {
+        unsigned long t0 = micros();
+        drawAltCounterDirect(alt);
+        direct.add(micros() - t0);
+        memcpy(reference, box, len * sizeof(Pixel));
+        for (int32_t y = 0; y < boxH; y++) memcpy(reference + len + y * boxW, att.row(boxY + y) + boxX, boxW * sizeof(Pixel));
+
+        t0 = micros();
+        drawAltCounter(alt);
+        drums.add(micros() - t0);
+
+        unsigned long frameDiff = 0;
+        for (size_t i = 0; i < len; i++)
+            if (box[i] != reference[i]) frameDiff++;
+        for (int32_t y = 0; y < boxH; y++)
+            for (int32_t x = 0; x < boxW; x++)
+                if (att.row(boxY + y)[boxX + x] != reference[len + y * boxW + x]) frameDiff++;
+
+        diff += frameDiff;
+        if (rollover) {
+            rollFrames++;
+            rollDiff += frameDiff;
+        }
+    };
+
+    for (float alt = 0.0f; alt <= 50000.0f; alt += 7.7f) run(alt, false);
+    for (float edge : { 1000.0f, 2000.0f, 10000.0f, 20000.0f, 30000.0f, 50000.0f })
+        for (float alt = edge - 25.0f; alt <= edge + 5.0f; alt += 0.1f) run(alt, true);
+
+    free(reference);
+
+    perfStatus("bench counter font:  avg %luus max %lu", direct.avg(), direct.max);
+    perfStatus("bench counter drums: avg %luus max %lu", drums.avg(), drums.max);
+    perfStatus("bench counter: %lu frames, %lu px differ; rollovers %lu frames, %lu px", drums.count, diff, rollFrames, rollDiff);
+}
+
+// A take-off and climb at 50 Hz, drawn twice: every frame a full redraw of
+// both tapes, then scrolling as in flight. Frames are compared by hash of the
+// on-screen part of each tape.
+void CC_ISIS::benchTapeScroll()
+{
+    const int frames = 3000;
+    uint32_t *hashes = (uint32_t *)ps_malloc(frames * 2 * sizeof(uint32_t));
+    if (!hashes) {
+        perfStatus("bench scroll: no memory");
+        return;
+    }
+
+    // 30 s take-off roll to 160 kt, then 30 s climbing at 2500 fpm while
+    // accelerating towards 250 kt, with a little turbulence on both.
+    auto profile = [](int frame, float &speed, float &alt) {
+        float t = frame * 0.02f;
+        if (t < 30.0f) {
+            speed = 30.0f + t * 130.0f / 30.0f;
+            alt   = 0.0f;
+        } else {
+            speed = 160.0f + (t - 30.0f) * 3.0f;
+            alt   = (t - 30.0f) * 2500.0f / 60.0f;
+        }
+        speed += 0.6f * sinf(t * 7.0f);
+        alt += 4.0f * sinf(t * 3.0f);
+        if (alt < 0.0f) alt = 0.0f;
+    };
+
+    auto hash = [](const PixelSurface &s, int32_t w) {
+        uint32_t h = 2166136261u;
+        for (int32_t y = 0; y < s.height; y++)
+            for (int32_t x = 0; x < w; x++) h = (h ^ s.row(y)[x]) * 16777619u;
+        return h;
+    };
+
+    const PixelSurface speed = surfaceOf(speedSprite);
+    const PixelSurface alt   = surfaceOf(altSprite);
+    const int32_t      altW  = min(alt.width, lcd.width() - (ALT_LEFT_EDGE - 2));
+
+    PerfSample    speedTime[2], altTime[2];
+    unsigned long speedDiffer = 0, altDiffer = 0, speedScrolled = 0, altScrolled = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        speedStripTop = INT32_MIN;
+        altTape.invalidate();
+        speedScrolled = speedScrolls;
+        altScrolled   = altTape.scrolls;
+
+        for (int f = 0; f < frames; f++) {
+            profile(f, isisState.airspeed, isisState.altitude);
+            if (pass == 0) {
+                speedStripTop = INT32_MIN;
+                altTape.invalidate();
+            }
+
+            unsigned long t0 = micros();
+            drawSpeedTape();
+            speedTime[pass].add(micros() - t0);
+            t0 = micros();
+            drawAltTape();
+            altTime[pass].add(micros() - t0);
+
+            uint32_t hs = hash(speed, speed.width), ha = hash(alt, altW);
+            if (pass == 0) {
+                hashes[f * 2]     = hs;
+                hashes[f * 2 + 1] = ha;
+            } else {
+                if (hs != hashes[f * 2]) speedDiffer++;
+                if (ha != hashes[f * 2 + 1]) altDiffer++;
+            }
+        }
+        speedScrolled = speedScrolls - speedScrolled;
+        altScrolled   = altTape.scrolls - altScrolled;
+    }
+
+    free(hashes);
+
+    perfStatus("bench scroll speed: full avg %luus, scrolled avg %luus max %lu", speedTime[0].avg(), speedTime[1].avg(), speedTime[1].max);
+    perfStatus("bench scroll alt:   full avg %luus, scrolled avg %luus max %lu", altTime[0].avg(), altTime[1].avg(), altTime[1].max);
+    perfStatus("bench scroll: %d frames, scrolled speed %lu alt %lu, differ speed %lu alt %lu", frames, speedScrolled, altScrolled,
+               speedDiffer, altDiffer);
+}
+
+// The QNH, STD and Mach readouts with sprintf and the smooth font vs from
+// the DigitFont glyphs, into the QNH readout's sprite without pushing it.
+void CC_ISIS::benchReadouts()
+{
+    if (!pressureDigits.valid() || !stdDigits.valid() || !machDigits.valid()) {
+        perfStatus("bench readouts: no glyphs");
+        return;
+    }
+
+    LGFX_Sprite &kohlsSprite = pressureReadout.sprite();
+    const size_t len         = kohlsSprite.bufferLength();
+    Pixel       *reference   = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench readouts: no memory");
+        return;
+    }
+
+    const Pixel       *canvas = (const Pixel *)kohlsSprite.getBuffer();
+    const PixelSurface kohls  = surfaceOf(kohlsSprite);
+    PerfSample         font, glyphs;
+    unsigned long      frames = 0, framesDiffering = 0, diff = 0;
+
+    // value < 0: STD; 0..2000: QNH; above: Mach * 10000
+    auto run = [&](int value) {
+        char buf[8];
+
+        unsigned long t0 = micros();
+        kohlsSprite.fillSprite(TFT_BLACK);
+        if (value < 0) {
+            kohlsSprite.setTextColor(TFT_BLUE);
+            kohlsSprite.setTextSize(1.2);
+            kohlsSprite.drawString("STD", 1, 1);
+        } else if (value < 2000) {
+            kohlsSprite.setTextColor(TFT_BLUE);
+            kohlsSprite.setTextSize(1.0);
+            kohlsSprite.drawNumber(value, 1, 1);
+        } else {
+            kohlsSprite.setTextColor(TFT_GREEN);
+            kohlsSprite.setTextSize(1.0);
+            sprintf(buf, "%.2f", value / 10000.0f);
+            kohlsSprite.drawString(buf[0] == '0' && buf[1] == '.' ? buf + 1 : buf, 1, 1);
+        }
+        font.add(micros() - t0);
+        memcpy(reference, canvas, len);
+
+        t0 = micros();
+        kohlsSprite.fillSprite(TFT_BLACK);
+        if (value < 0) {
+            stdDigits.drawString(kohls, "STD", 1, 1);
+        } else if (value < 2000) {
+            pressureDigits.drawNumber(kohls, value, 1, 1);
+        } else {
+            DigitFont::formatFixed(buf, value / 10000.0f, 2, true);
+            machDigits.drawString(kohls, buf, 1, 1);
+        }
+        glyphs.add(micros() - t0);
+
+        unsigned long frameDiff = 0;
+        for (size_t i = 0; i < len / sizeof(Pixel); i++)
+            if (canvas[i] != reference[i]) frameDiff++;
+        frames++;
+        diff += frameDiff;
+        if (frameDiff) framesDiffering++;
+    };
+
+    run(-1);
+    for (int qnh = 900; qnh <= 1100; qnh++) run(qnh);
+    for (int mach = 4500; mach <= 12000; mach += 13) run(mach);
+
+    free(reference);
+
+    perfStatus("bench readouts font:   avg %luus max %lu", font.avg(), font.max);
+    perfStatus("bench readouts glyphs: avg %luus max %lu", glyphs.avg(), glyphs.max);
+    perfStatus("bench readouts: %lu frames, %lu differ, %lu px; glyphs %u bytes", frames, framesDiffering, diff,
+               (unsigned)(pressureDigits.bytes() + stdDigits.bytes() + machDigits.bytes()));
+}
+
+void CC_ISIS::benchAtlasFonts()
+{
+    LGFX_Sprite canvas;
+    canvas.setColorDepth(ISIS_COLOR_DEPTH);
+    if (!canvas.createSprite(400, 80)) {
+        perfStatus("bench atlas fonts: no memory");
+        return;
+    }
+    Pixel *reference = (Pixel *)ps_malloc(canvas.bufferLength());
+    if (!reference) {
+        canvas.deleteSprite();
+        perfStatus("bench atlas fonts: no memory");
+        return;
+    }
+
+    const Pixel       *pixels  = (const Pixel *)canvas.getBuffer();
+    const PixelSurface surface = surfaceOf(canvas);
+    const int          reps    = 200;
+
+    struct Case {
+        const char      *name;
+        const uint8_t   *vlw;
+        const AtlasFace &face;
+        float            size;
+        uint16_t         fg;
+        const char      *text;
+    };
+    const Case cases[] = {
+        { "A320 1.0", A320ISIS24, A320ISIS24_10, 1.0f, TFT_BLUE, "-0123456789." },
+        { "A320 1.2", A320ISIS24, A320ISIS24_12, 1.2f, TFT_BLUE, "0123456789STD" },
+    };
+
+    for (const Case &c : cases) {
+        const AtlasFont atlasFont(c.face, c.fg, TFT_BLACK);
+        const int       glyphs = strlen(c.text);
+
+        canvas.loadFont(c.vlw);
+        canvas.setTextSize(c.size);
+        canvas.setTextDatum(TL_DATUM);
+        canvas.setTextColor(c.fg);
+
+        canvas.fillSprite(TFT_BLACK);
+        unsigned long t0 = micros();
+        for (int i = 0; i < reps; i++) canvas.drawString(c.text, 2, 2);
+        unsigned long font = micros() - t0;
+        canvas.fillSprite(TFT_BLACK);
+        canvas.drawString(c.text, 2, 2);
+        memcpy(reference, pixels, canvas.bufferLength());
+        canvas.unloadFont();
+
+        canvas.fillSprite(TFT_BLACK);
+        t0 = micros();
+        for (int i = 0; i < reps; i++) atlasFont.drawString(surface, c.text, 2, 2);
+        unsigned long atlas = micros() - t0;
+        canvas.fillSprite(TFT_BLACK);
+        atlasFont.drawString(surface, c.text, 2, 2);
+
+        unsigned long diff = 0;
+        for (size_t i = 0; i < canvas.bufferLength() / sizeof(Pixel); i++)
+            if (pixels[i] != reference[i]) diff++;
+
+        perfStatus("bench atlas %s: loadFont %luns/glyph, atlas %luns/glyph, %lu px differ", c.name,
+                   font * 1000UL / (reps * glyphs), atlas * 1000UL / (reps * glyphs), diff);
+    }
+
+    free(reference);
+    canvas.deleteSprite();
+
+    // Flash: the VLW array against everything the atlas header defines.
+    const size_t a320Atlas = sizeof(A320ISIS24_bitmap) + sizeof(A320ISIS24_10_glyphs) + sizeof(A320ISIS24_12_glyphs) + 2 * sizeof(AtlasFace);
+    perfStatus("bench atlas flash: A320ISIS24 %u -> %u bytes", (unsigned)sizeof(A320ISIS24), (unsigned)a320Atlas);
+}
+
+// The attitude drawn in attSprite and uploaded, against drawn in place in the back buffer.
+void CC_ISIS::benchDirectAttitude()
+{
+    const int          FRAMES = 50;
+    const PixelSurface frame  = framePresenter.surface(ATT_LEFT_EDGE, ATT_TOP_EDGE, ATT_WIDTH, ATT_HEIGHT);
+    if (!frame.pixels || !staticOverlay.valid()) {
+        perfStatus("bench attitude in place: needs the back buffer and the overlay");
+        return;
+    }
+
+    const bool async            = framePresenter.asyncUploads;
+    framePresenter.asyncUploads = false; // the copy is part of the sprite path's time here
+
+    PerfSample time[2];
+    uint32_t   pixels[2] = { 0, 0 };
+    for (int inPlace = 0; inPlace < 2; inPlace++) {
+        attTarget = inPlace ? frame : surfaceOf(attSprite);
+        for (int f = 0; f < FRAMES; f++) {
+            isisState.bankAngle  = -40.0f + f * 1.7f;
+            isisState.pitchAngle = -10.0f + f * 0.4f;
+
+            uint32_t      px = blitPixelsWritten();
+            unsigned long t0 = micros();
+            drawAttitude();
+            drawBackground();
+            if (!inPlace) framePresenter.upload(attSprite, ATT_LEFT_EDGE, ATT_TOP_EDGE, DamageRect{ 0, 0, ATT_WIDTH, ATT_HEIGHT });
+            time[inPlace].add(micros() - t0);
+            pixels[inPlace] += blitPixelsWritten() - px;
+        }
+    }
+
+    // Both passes ended on the same attitude, so the back buffer should hold what attSprite does.
+    const PixelSurface sprite     = surfaceOf(attSprite);
+    int                mismatched = 0;
+    for (int32_t y = 0; y < ATT_HEIGHT; y++)
+        if (memcmp(frame.row(y), sprite.row(y), ATT_WIDTH * sizeof(Pixel)) != 0) mismatched++;
+
+    framePresenter.asyncUploads = async;
+    attTarget                   = surfaceOf(attSprite);
+    attDirect                   = false;
+
+    // PSRAM bytes written per frame, and for the sprite the copy's read and write on top.
+    const unsigned long copy = 2UL * ATT_WIDTH * ATT_HEIGHT * sizeof(Pixel);
+    perfStatus("bench attitude via attSprite: avg %luus max %lu, %lu KB PSRAM/frame", time[0].avg(), time[0].max,
+               (pixels[0] / FRAMES * sizeof(Pixel) + copy) / 1024);
+    perfStatus("bench attitude in place:      avg %luus max %lu, %lu KB PSRAM/frame", time[1].avg(), time[1].max,
+               (unsigned long)(pixels[1] / FRAMES * sizeof(Pixel) / 1024));
+    perfStatus("bench attitude in place: %d frames, %d rows differ", FRAMES, mismatched);
+}
+
+// The whole frame at this build's colour depth (-DISIS_RGB565 or not): draw and flip times, the
+// bytes moved, and the memory taken. Run it in both builds to compare them.
+void CC_ISIS::benchColorDepth()
+{
+    const int FRAMES = 300;
+
+    framePresenter.resetStats();
+    const FramePresenter::PanelCounts panelStart = framePresenter.panelCounts();
+
+    PerfSample    drawTime, flipTime;
+    unsigned long pixels = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        // A climbing turn: everything moves each frame.
+        isisState.bankAngle  = 25.0f * sinf(f * 0.02f);
+        isisState.pitchAngle = 8.0f + 4.0f * sinf(f * 0.03f);
+        isisState.ballPos    = 0.3f * sinf(f * 0.05f);
+        isisState.airspeed   = 180.0f + f * 0.2f;
+        isisState.altitude   = 3000.0f + f * 7.0f;
+
+        uint32_t      px = blitPixelsWritten();
+        unsigned long t0 = micros();
+        draw();
+        unsigned long t1 = micros();
+        framePresenter.flip();
+        flipTime.add(micros() - t1);
+        drawTime.add(t1 - t0);
+        pixels += blitPixelsWritten() - px;
+    }
+
+    const FramePresenter::PanelCounts panelEnd = framePresenter.panelCounts();
+    const unsigned long               bpp      = sizeof(Pixel);
+    const unsigned long               scanned  = (unsigned long)lcd.width() * lcd.height() * (ISIS_PANEL_DEPTH / 8) * (panelEnd.intervals - panelStart.intervals);
+
+    // The flip copy reads the back buffer and writes the panel's.
+    perfStatus("bench depth %d bpp, panel %d: draw avg %luus max %lu, flip avg %luus max %lu", ISIS_COLOR_DEPTH, ISIS_PANEL_DEPTH,
+               drawTime.avg(), drawTime.max, flipTime.avg(), flipTime.max);
+    perfStatus("bench depth KB/frame: %lu drawn, %lu uploaded, %lu flipped, %lu scanned out", pixels * bpp / FRAMES / 1024,
+               framePresenter.pixelsUploaded * bpp / FRAMES / 1024, 2 * framePresenter.pixelsFlipped * bpp / FRAMES / 1024,
+               scanned / FRAMES / 1024);
+
+    const LGFX_Sprite *sprites[] = { &attSprite, &slipSprite, &ladderValSprite, &blackoutArcSprite, &speedSprite,
+                                     &speedStrip, &altSprite, &alt100Sprite, &altLabelSprite };
+    unsigned long      spriteBytes = 0;
+    for (const LGFX_Sprite *s : sprites) spriteBytes += s->bufferLength();
+    const unsigned long back = framePresenter.doubleBuffered() ? (unsigned long)lcd.width() * lcd.height() * bpp : 0;
+    perfStatus("bench depth memory KB: boot RAM %lu PSRAM %lu, sprites %lu, back buffer %lu", (unsigned long)bootRamBytes / 1024,
+               (unsigned long)bootPsramBytes / 1024, spriteBytes / 1024, back / 1024);
+
+    framePresenter.resetStats();
+}
+
+// The whole back buffer flipped to the panel as RGB332 and through a palette (ISISPalette.h), what
+// building a palette costs, and how many of the 256 codes a frame uses.
+void CC_ISIS::benchPalette()
+{
+    const int FRAMES = 30;
+    if (!framePresenter.doubleBuffered() || sizeof(Pixel) != 1) {
+        perfStatus("bench palette: needs the back buffer and 8-bit pixels");
+        return;
+    }
+
+    isisState.bankAngle  = 15.0f;
+    isisState.pitchAngle = 5.0f;
+    isisState.altitude   = 3500.0f;
+    isisState.airspeed   = 210.0f;
+    draw();
+    framePresenter.flip();
+
+    const PixelSurface frame = framePresenter.surface(0, 0, lcd.width(), lcd.height());
+    uint32_t           used[256 / 32] = {};
+    for (int32_t y = 0; y < frame.height; y++)
+        for (int32_t x = 0; x < frame.width; x++) used[frame.row(y)[x] >> 5] |= 1UL << (frame.row(y)[x] & 31);
+    int codes = 0;
+    for (uint32_t bits : used) codes += __builtin_popcount(bits);
+
+    static Palette              palette; // the presenter reads it at every flip
+    const lgfx::bgr888_t *const shown = framePresenter.palette();
+    PerfSample                  build, copy[2];
+    for (int paletted = 0; paletted < 2; paletted++) {
+        framePresenter.resetStats();
+        for (int f = 0; f < FRAMES; f++) {
+            if (paletted) {
+                unsigned long t0 = micros();
+                palette.build(f & 1 ? Palette::NIGHT : Palette::DAY, 255 - f * 4);
+                build.add(micros() - t0);
+                framePresenter.setPalette(palette.colors());
+            } else {
+                framePresenter.setPalette(nullptr);
+            }
+            framePresenter.flip();
+        }
+        copy[paletted] = framePresenter.copyTime;
+    }
+    framePresenter.setPalette(shown);
+    framePresenter.resetStats();
+
+    perfStatus("bench palette: %d of 256 codes on screen, palette built in %luus", codes, build.avg());
+    perfStatus("bench palette full flip, %d bpp panel: 332 avg %luus max %lu, palette avg %luus max %lu", lcd.getColorDepth(),
+               copy[0].avg(), copy[0].max, copy[1].avg(), copy[1].max);
+}
+
+// The tearing test for benchSnapshot(): a task on the other core publishes states whose pitch, bank,
+// airspeed and altitude all derive from one count, through a seqlock and into a plain shared copy.
+struct SnapshotStress {
+    Seqlock<ISISState> locked;
+    ISISState          plain;
+    volatile bool      stop = false;
+    volatile bool      done = false;
+    uint32_t           writes = 0;
+};
+
+static void snapshotWriter(void *arg)
+{
+    SnapshotStress *s = (SnapshotStress *)arg;
+    ISISState       state;
+    for (uint32_t n = 1; !s->stop; n++) {
+        state.rawPitchAngle = n;
+        state.rawBankAngle  = -(float)n;
+        state.rawAirspeed   = n;
+        state.rawAltitude   = n + 0.5f;
+        s->locked.publish(state);
+
+        volatile ISISState &plain = s->plain;
+        plain.rawPitchAngle       = state.rawPitchAngle;
+        plain.rawBankAngle        = state.rawBankAngle;
+        plain.rawAirspeed         = state.rawAirspeed;
+        plain.rawAltitude         = state.rawAltitude;
+        s->writes                 = n;
+    }
+    s->done = true;
+    vTaskDelete(nullptr);
+}
+
+static bool torn(const ISISState &state)
+{
+    return state.rawBankAngle != -state.rawPitchAngle || state.rawAirspeed != state.rawPitchAngle ||
+           state.rawAltitude != state.rawPitchAngle + 0.5f;
+}
+
+// Reads of ISISState through the seqlock the render task takes its snapshots with, against plain
+// copies, while the other core writes as fast as it can. Every read should be whole through the
+// seqlock; the plain copies show the test can catch one that isn't.
+void CC_ISIS::benchSnapshot()
+{
+    const unsigned long RUN_MS = 1000;
+
+    static SnapshotStress s; // both cores use it
+    s.stop = s.done = false;
+    s.writes        = 0;
+    if (xTaskCreatePinnedToCore(snapshotWriter, "isisStress", 2048, &s, 1, nullptr, 1 - xPortGetCoreID()) != pdPASS) {
+        perfStatus("bench snapshot: can't start the writer");
+        return;
+    }
+
+    unsigned long reads[2] = { 0, 0 }, tornReads[2] = { 0, 0 }, retries = 0;
+    PerfSample    readTime;
+    ISISState     copy;
+    for (int plain = 0; plain < 2; plain++) {
+        const unsigned long start = millis();
+        while (millis() - start < RUN_MS / 2) {
+            if (plain) {
+                copy = s.plain;
+            } else {
+                unsigned long t0 = micros();
+                retries += s.locked.read(copy);
+                readTime.add(micros() - t0);
+            }
+            reads[plain]++;
+            if (copy.rawPitchAngle != 0 && torn(copy)) tornReads[plain]++;
+        }
+    }
+    s.stop = true;
+    while (!s.done) delay(1);
+
+    perfStatus("bench snapshot: %lu writes, seqlock %lu reads %lu torn, plain %lu reads %lu torn", (unsigned long)s.writes,
+               reads[0], tornReads[0], reads[1], tornReads[1]);
+    perfStatus("bench snapshot: read avg %luus max %lu, %lu retries", readTime.avg(), readTime.max, retries);
+}
+
+// The attitude and overlays drawn on one core, against in two bands on both (ISISBands.h), through
+// a turn that carries the ladder, its labels and the horizon line across the band boundary.
+void CC_ISIS::benchAttBands()
+{
+    const int FRAMES = 200;
+    if (!attBands.running() || !staticOverlay.valid() || !ladderLabels.enabled) {
+        perfStatus("bench bands: needs the band task, the overlay and the label cache");
+        return;
+    }
+
+    const size_t len       = attSprite.bufferLength();
+    Pixel       *reference = (Pixel *)ps_malloc(len);
+    if (!reference) {
+        perfStatus("bench bands: no memory");
+        return;
+    }
+
+    attBands.resetStats();
+    PerfSample    one, two;
+    unsigned long pixels[2]  = { 0, 0 };
+    int           mismatched = 0;
+    for (int f = 0; f < FRAMES; f++) {
+        isisState.bankAngle  = -60.0f + f * 0.6f;
+        isisState.pitchAngle = 12.0f * sinf(f * 0.05f);
+        isisState.ballPos    = 0.1f * sinf(f * 0.03f);
+        updateSlip();
+
+        uint32_t      px = blitPixelsWritten();
+        unsigned long t0 = micros();
+        drawAttitudeBand(attBand());
+        drawBackground();
+        one.add(micros() - t0);
+        pixels[0] += blitPixelsWritten() - px;
+        memcpy(reference, attSprite.getBuffer(), len);
+
+        px = blitPixelsWritten();
+        t0 = micros();
+        attBands.draw(drawAttBand, this);
+        two.add(micros() - t0);
+        pixels[1] += blitPixelsWritten() - px;
+
+        if (memcmp(reference, attSprite.getBuffer(), len) != 0) mismatched++;
+    }
+    free(reference);
+
+    const unsigned long speedup = two.avg() ? one.avg() * 100 / two.avg() : 0;
+    perfStatus("bench bands one core:  avg %luus max %lu, %lu px/frame", one.avg(), one.max, pixels[0] / FRAMES);
+    perfStatus("bench bands two cores: avg %luus max %lu, %lu px/frame", two.avg(), two.max, pixels[1] / FRAMES);
+    perfStatus("bench bands: %lu.%02lux, split at rows %lu..%lu, imbalance avg %luus max %lu", speedup / 100, speedup % 100,
+               attBands.bandRows.min, attBands.bandRows.max, attBands.imbalance.avg(), attBands.imbalance.max);
+    perfStatus("bench bands: %d frames, %d mismatched", FRAMES, mismatched);
+    attBands.resetStats();
+}
+
+// Whole frames drawn as fast as they go and paced by the scheduler (ISISSchedule.h), at the
+// configured rate or, with none, one frame a refresh: how steady the time between frames is, and what
+// the readouts' lower rates take off the average frame.
+void CC_ISIS::benchFramePacing()
+{
+    const int      FRAMES   = 120;
+    const uint32_t periodUs = frameScheduler.periodUs();
+    const uint32_t pacedUs  = periodUs ? periodUs : framePresenter.framePeriodUs();
+
+    for (int paced = 0; paced < 2; paced++) {
+        frameScheduler.setPeriod(paced ? pacedUs : 0);
+        frameScheduler.resetStats();
+        PerfSample    drawTime;
+        unsigned long start = micros();
+        for (int f = 0; f < FRAMES; f++) {
+            frameScheduler.wait();
+            frameScheduler.startFrame();
+            // A climbing turn through changing weather: everything moves each frame.
+            isisState.bankAngle  = 25.0f * sinf(f * 0.02f);
+            isisState.pitchAngle = 8.0f + 4.0f * sinf(f * 0.03f);
+            isisState.airspeed   = 180.0f + f * 0.2f;
+            isisState.altitude   = 3000.0f + f * 7.0f;
+            isisState.mbPressure = 1013 - f / 8;
+            isisState.machSpeed  = 0.3f + f * 0.001f;
+
+            unsigned long t0 = micros();
+            draw();
+            drawTime.add(micros() - t0);
+            framePresenter.flip();
+            frameScheduler.endFrame();
+        }
+        const unsigned long fps = FRAMES * 1000000ULL / max(micros() - start, 1UL);
+        perfStatus("bench pacing %s: %lu fps, draw avg %luus, interval p50 %lu p99 %lu max %luus", paced ? "paced" : "free",
+                   fps, drawTime.avg(), frameScheduler.interval.percentile(50), frameScheduler.interval.percentile(99),
+                   frameScheduler.interval.max);
+        perfStatus("bench pacing %s: jitter avg %luus max %lu, %lu dropped, qnh in %lu/%d frames", paced ? "paced" : "free",
+                   frameScheduler.jitter.avg(), frameScheduler.jitter.max, frameScheduler.dropped, frameScheduler.layerFrames[LAYER_QNH], FRAMES);
+    }
+    frameScheduler.setPeriod(periodUs);
+    frameScheduler.resetStats();
+}
+
+void CC_ISIS::runBenchmarks()
+{
+    ISISState saved = isisState;
+
+    // The benchmarks' frames draw every layer, and the attitude in attSprite unless they say otherwise.
+    frameScheduler.drawAll();
+    attTarget = surfaceOf(attSprite);
+    attDirect = false;
+
+    // Seconds of drawing with no sleep in them. On core 0 (the render task) that would keep its idle
+    // task from feeding the watchdog.
+    const bool onCore0 = xPortGetCoreID() == 0;
+    if (onCore0) disableCore0WDT();
+
+    perfStatus("bench start");
+    benchHorizonFill();
+    benchLadderLabels();
+    benchAdiTexture();
+    benchRotatedBlit();
+    benchSlipComposite();
+    benchBackground();
+    benchMask();
+    benchSpeedTape();
+    benchAltTape();
+    benchAltCounter();
+    benchTapeScroll();
+    benchReadouts();
+    benchAtlasFonts();
+    benchDirectAttitude();
+    benchColorDepth();
+    benchPalette();
+    benchSnapshot();
+    benchAttBands();
+    benchFramePacing();
+    perfStatus("bench done");
+    if (onCore0) enableCore0WDT();
+
+    // Put back what the benchmarks drew over outside the visible spans, and draw in attSprite
+    // until chooseAttTarget() takes it across again.
+    attTarget = surfaceOf(attSprite);
+    attDirect = false;
+    attSprite.fillSprite(TFT_BLACK);
+    drawBlackoutArcs();
+    speedStripTop = INT32_MIN;
+    altTape.invalidate();
+    pressureReadout.invalidate();
+    machReadout.invalidate();
+    panelDirty = true;
+
+    isisState = saved;
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "ISISAdiTexture.h"
+
+bool AdiTexture::begin(int16_t width, int16_t height, int16_t horizonRow, float pxPerDeg)
+{
+    _horizonRow = horizonRow;
+    _pxPerDeg   = pxPerDeg;
+
+    for (LGFX_Sprite *tex : { &_tex, &_inverted }) {
+        tex->setPsram(true);
+        tex->setColorDepth(ISIS_COLOR_DEPTH);
+        if (!tex->createSprite(width, height)) {
+            _tex.deleteSprite();
+            return false;
+        }
+    }
+    return true;
+}
+
+void AdiTexture::setBackground(Pixel sky, Pixel horizon, Pixel ground)
+{
+    _sky     = sky;
+    _horizon = horizon;
+    _ground  = ground;
+}
+
+void AdiTexture::draw(const PixelSurface &dst, float centerX, float centerY, float pitch, float bank, int32_t bandTop, int32_t bandBottom,
+                      const RowSpan *mask) const
+{
+    const bool   inverted = bank > 90.0f || bank < -90.0f;
+    const Pixel *tex      = (const Pixel *)(inverted ? _inverted : _tex).getBuffer();
+    if (!tex) return;
+
+    const int32_t texW = _tex.width();
+    const int32_t texH = _tex.height();
+    if (bandTop < 0) bandTop = 0;
+    if (bandBottom > texH - 1) bandBottom = texH - 1;
+
+    const float bankRad = bank * PIf / 180.0f;
+    const float cosBank = cosf(bankRad);
+    const float sinBank = sinf(bankRad);
+
+    // Screen (dx, dy) from the centre maps back to the unrotated ball at
+    //   u =  dx * cos + dy * sin
+    //   v = -dx * sin + dy * cos
+    // which is the inverse of the rotation drawAttitude() applies to the ladder.
+    // Texture column texW / 2 is the ball centre line, row v = 0 the current pitch.
+    const float   originV = _horizonRow + pitch * _pxPerDeg + 0.5f;
+    const int32_t stepU   = (int32_t)lroundf(cosBank * 65536.0f);
+    const int32_t stepV   = (int32_t)lroundf(-sinBank * 65536.0f);
+    const int32_t texCX   = texW / 2;
+
+    for (int32_t y = 0; y < dst.height; y++) {
+        int32_t x0 = 0, x1 = dst.width;
+        clipToMask(mask, y, x0, x1);
+        if (x0 >= x1) continue;
+
+        float   dx  = x0 - centerX;
+        float   dy  = y - centerY;
+        int32_t u   = (int32_t)lroundf((texCX + 0.5f + dx * cosBank + dy * sinBank) * 65536.0f);
+        int32_t v   = (int32_t)lroundf((originV - dx * sinBank + dy * cosBank) * 65536.0f);
+        Pixel  *out = dst.row(y);
+        ISIS_COUNT_PIXELS(out + x0, x1 - x0);
+
+        for (int32_t x = x0; x < x1; x++) {
+            int32_t ty = v >> 16;
+            if (ty < bandTop || ty > bandBottom) {
+                out[x] = ty < _horizonRow ? _sky : (ty <= _horizonRow + 1 ? _horizon : _ground);
+            } else {
+                int32_t tx = u >> 16;
+                if (tx < 0) tx = 0;
+                if (tx >= texW) tx = texW - 1;
+                out[x] = tex[ty * texW + tx];
+            }
+            u += stepU;
+            v += stepV;
+        }
+    }
+}
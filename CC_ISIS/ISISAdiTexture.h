@@ -0,0 +1,48 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+
+// Pre-rendered attitude ball.
+//
+// The sky, ground, horizon, pitch lines and labels from +90° to -90° are drawn
+// once, unrotated, into a tall PSRAM texture at PITCH_SCALE px/deg. Each frame
+// draw() walks attSprite once and samples the texture through the inverse bank
+// rotation with Q16 fixed-point stepping, so the cost is the same for every
+// attitude no matter how many ladder lines are in view.
+//
+// Texture columns outside the ladder are plain sky / horizon / ground, so
+// samples off the sides are clamped to the edge column.
+//
+// Past 90° of bank the line-drawn ladder turns its labels the other way up
+// (bank + 180), so there is a second texture with the labels baked turned
+// half round their pivots, and draw() samples that one when inverted. It is
+// the same size again in PSRAM.
+class AdiTexture
+{
+public:
+    bool begin(int16_t width, int16_t height, int16_t horizonRow, float pxPerDeg);
+    bool valid() const { return _tex.getBuffer() != nullptr; }
+
+    // Draw the ball contents into these after begin(): the same, but for the labels.
+    LGFX_Sprite &canvas() { return _tex; }
+    LGFX_Sprite &invertedCanvas() { return _inverted; }
+
+    int16_t centerX() const { return _tex.width() / 2; }
+    int16_t rowOf(float deg) const { return _horizonRow + (int16_t)(deg * _pxPerDeg); }
+
+    // Colours used outside the visible ladder band. The horizon is 2 rows thick.
+    void setBackground(Pixel sky, Pixel horizon, Pixel ground);
+
+    // Sample the ball into dst. (centerX, centerY) is the rotation centre in dst.
+    // Only texture rows bandTop..bandBottom show ladder lines and labels.
+    void draw(const PixelSurface &dst, float centerX, float centerY, float pitch, float bank, int32_t bandTop, int32_t bandBottom,
+              const RowSpan *mask = nullptr) const;
+
+private:
+    LGFX_Sprite _tex;
+    LGFX_Sprite _inverted; // labels the other way up, for past 90° of bank
+    int16_t     _horizonRow = 0;
+    float       _pxPerDeg   = 1.0f;
+    Pixel       _sky = 0, _horizon = 0, _ground = 0;
+};
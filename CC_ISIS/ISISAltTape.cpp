@@ -0,0 +1,205 @@
+#include "ISISAltTape.h"
+
+#include <new>
+
+void AltTape::drawMark(LGFX_Sprite &sprite, int32_t y)
+{
+    sprite.drawWideLine(2, y, 2 + ALT_TAPE_MARK_WIDTH, y, 1, TFT_WHITE);
+}
+
+void AltTape::drawLabel(LGFX_Sprite &sprite, int alt, int32_t y)
+{
+    char buf[8];
+    sprintf(buf, "%03d", abs(alt) / 100); // absolute value — NEG indicator handles sign
+    sprite.drawString(buf, 10, y + 2);
+}
+
+bool AltTape::begin(int16_t width, LGFX_Sprite *labelSprite)
+{
+    _label = labelSprite;
+
+    size_t tableSize = sizeof(RunImage *) * LABEL_COUNT;
+    _images          = (RunImage **)ISIS_PSRAM_MALLOC(tableSize);
+    _capture         = (Pixel *)ISIS_PSRAM_MALLOC(_label->bufferLength());
+    if (!_images || !_capture) return false;
+    memset(_images, 0, tableSize);
+    _bytes = tableSize + _label->bufferLength();
+
+    _ticks.setPsram(true);
+    _ticks.setColorDepth(ISIS_COLOR_DEPTH);
+    if (!_ticks.createSprite(width, PERIOD * 2)) return false;
+    _ticks.fillSprite(TFT_BLACK);
+
+    // Even hundreds at row 0 of each phase, odd hundreds 25 (phase 0) or 24
+    // (phase 1) rows above them. Neighbouring periods are drawn clipped so
+    // anything a mark spills into the next row wraps round.
+    for (int phase = 0; phase < 2; phase++) {
+        const int32_t top = phase * PERIOD;
+        _ticks.setClipRect(0, top, width, PERIOD);
+        for (int32_t y = top - PERIOD; y <= top + PERIOD; y += PERIOD) {
+            drawMark(_ticks, y);
+            drawMark(_ticks, y + PERIOD / 2 + phase);
+        }
+    }
+    _ticks.clearClipRect();
+    _bytes += _ticks.bufferLength();
+
+    // All of them now, like PitchLabelCache, so text rendering and PSRAM allocation stay out of the frames.
+    for (int i = 0; i < LABEL_COUNT; i++) _images[i] = render(i);
+    return true;
+}
+
+// The label over two backgrounds, in _capture and _label; whatever did not change is the label and its box.
+void AltTape::capture(int alt, int32_t y)
+{
+    _label->fillSprite(TFT_BLUE);
+    drawLabel(*_label, alt, y);
+    memcpy(_capture, _label->getBuffer(), _label->bufferLength());
+    _label->fillSprite(TFT_RED);
+    drawLabel(*_label, alt, y);
+}
+
+RunImage *AltTape::render(int index)
+{
+    const int32_t y = _label->height() / 2 - 2;
+    capture(index * 500, y);
+
+    void *mem = ISIS_PSRAM_MALLOC(sizeof(RunImage));
+    if (!mem) return nullptr;
+    RunImage *image = new (mem) RunImage();
+    if (!image->encodeCapture(_capture, (const Pixel *)_label->getBuffer(), _label->width(), _label->height(), _label->width())) {
+        image->~RunImage();
+        free(mem);
+        return nullptr;
+    }
+    image->originY = -y;
+
+    _bytes += sizeof(RunImage) + image->bytes();
+    _entries++;
+    return image;
+}
+
+// The pixels render() would keep, copied straight to dst with the label's mark at row y.
+void AltTape::drawDirect(const PixelSurface &dst, int alt, int32_t y)
+{
+    const int32_t top = _label->height() / 2 - 2;
+    capture(alt, top);
+    const Pixel  *pixels = (const Pixel *)_label->getBuffer();
+    const int32_t w      = min((int32_t)_label->width(), dst.width);
+    for (int32_t r = 0; r < _label->height(); r++) {
+        const int32_t dy = y - top + r;
+        if (dy < 0 || dy >= dst.height) continue;
+        const Pixel *a   = _capture + r * _label->width();
+        const Pixel *b   = pixels + r * _label->width();
+        Pixel       *out = dst.row(dy);
+        for (int32_t c = 0; c < w; c++)
+            if (a[c] == b[c]) out[c] = b[c];
+        ISIS_COUNT_PIXELS(out, w);
+    }
+}
+
+// Place the texture by the marks either side of a 200 ft boundary, computed
+// the way drawAltTape() computes every mark.
+void AltTape::place(float curAlt, int &alt0, int32_t &even, int32_t &phase)
+{
+    alt0  = (int)floorf(curAlt / 200.0f) * 200;
+    even  = markY(curAlt, alt0);
+    phase          = (even - markY(curAlt, alt0 + 100) == PERIOD / 2) ? 1 : 0;
+}
+
+void AltTape::composeRows(const PixelSurface &dst, int32_t y0, int32_t y1, int32_t even, int32_t phase) const
+{
+    if (y0 < 0) y0 = 0;
+    if (y1 > dst.height) y1 = dst.height;
+
+    const Pixel  *ticks = (const Pixel *)_ticks.getBuffer();
+    const int32_t w     = min((int32_t)_ticks.width(), dst.width);
+    int32_t       row   = ((y0 - even) % PERIOD + PERIOD) % PERIOD;
+    for (int32_t y = y0; y < y1; y++) {
+        Pixel *out = dst.row(y);
+        memcpy(out, ticks + (phase * PERIOD + row) * _ticks.width(), w * sizeof(Pixel));
+        ISIS_COUNT_PIXELS(out, w);
+        if (++row == PERIOD) row = 0;
+    }
+}
+
+// The parts that are not a plain window of the texture: the mark markY()
+// truncates onto row 0, and the labels.
+void AltTape::finish(const PixelSurface &dst, float curAlt)
+{
+    // markY() truncates toward zero, so a mark less than a row above the top still lands on row 0.
+    const int above = ((int)floorf((curAlt + ALT_TAPE_REFERENCE_Y / ALT_TAPE_PX_PER_FT) / 100.0f) + 1) * 100;
+    if (markY(curAlt, above) == 0 && dst.height > 0) {
+        const int32_t w = min((int32_t)_ticks.width(), dst.width);
+        memcpy(dst.row(0), _ticks.getBuffer(), w * sizeof(Pixel));
+        ISIS_COUNT_PIXELS(dst.row(0), w);
+    }
+
+    // Labels every 500 ft over the same ±900 ft drawAltTape() walks.
+    const int top   = (int)floorf(curAlt / 100.0f) * 100 + 900;
+    const int first = top - ((top % 500) + 500) % 500;
+    for (int alt = first; alt >= top - 1800; alt -= 500) {
+        const int32_t y = markY(curAlt, alt);
+        if (y < 0 || y >= dst.height) continue;
+
+        const int       index = abs(alt) / 500;
+        const RunImage *image = index < LABEL_COUNT ? _images[index] : nullptr;
+        if (image) {
+            hits++;
+            image->draw(dst, 0, y);
+        } else {
+            misses++;
+            drawDirect(dst, alt, y);
+        }
+    }
+}
+
+void AltTape::draw(const PixelSurface &dst, float curAlt)
+{
+    if (!valid()) return;
+
+    int     alt0;
+    int32_t even, phase;
+    place(curAlt, alt0, even, phase);
+    composeRows(dst, 0, dst.height, even, phase);
+    finish(dst, curAlt);
+}
+
+void AltTape::drawScrolled(const PixelSurface &dst, float curAlt, int32_t dirtyTop, int32_t dirtyBottom)
+{
+    if (!valid()) return;
+
+    int     alt0;
+    int32_t even, phase;
+    place(curAlt, alt0, even, phase);
+
+    // Row y now shows what was in row y + delta, going by where last frame's
+    // 200 ft mark is now. A phase change moves the odd hundreds against the
+    // even ones, so that is a redraw, as is a long jump.
+    const int32_t delta = _drawn ? _even - markY(curAlt, _alt0) : 0;
+    moved = !_drawn || phase != _phase || delta != 0;
+    if (!_drawn || phase != _phase || delta >= dst.height / 2 || -delta >= dst.height / 2) {
+        redraws++;
+        composeRows(dst, 0, dst.height, even, phase);
+    } else {
+        scrolls++;
+        scrollRows(dst, delta, 0, min((int32_t)_ticks.width(), dst.width));
+        if (delta > 0)
+            composeRows(dst, dst.height - delta, dst.height, even, phase);
+        else
+            composeRows(dst, 0, 1 - delta, even, phase); // and the row the old row 0 went to, in case it held the truncated mark
+
+        // A label is dropped whole once its mark leaves the tape, so the rows a
+        // label can reach past either end are always composed again.
+        const int32_t above = _label->height() / 2 - 2;
+        composeRows(dst, 0, _label->height() - above, even, phase);
+        composeRows(dst, dst.height - above, dst.height, even, phase);
+        composeRows(dst, dirtyTop - delta, dirtyBottom - delta, even, phase); // scrolled along with the rest
+    }
+    finish(dst, curAlt); // redrawing a label that is already there changes nothing
+
+    _alt0  = alt0;
+    _even  = even;
+    _phase = phase;
+    _drawn = true;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+
+#define ALT_TAPE_PX_PER_FT   0.245f // 24.5 px per 100 ft mark
+#define ALT_TAPE_REFERENCE_Y 179.0f // y in altSprite where the current-alt tick sits. Found with trial and error
+#define ALT_TAPE_MARK_WIDTH  15
+
+// Altitude tape marks and labels, composed from pre-rendered pieces.
+//
+// Marks are 24.5 px apart, so the tape repeats every 200 ft (49 rows). Each
+// mark's y is truncated on its own, which puts the odd hundreds 24 or 25 rows
+// above the even ones depending on where the tape sits within a pixel, so the
+// tick texture holds the 49-row period in both phases.
+//
+// The labels (every 500 ft, "000" .. "995") are all rendered in begin() and
+// kept in PSRAM as RunImages, including the black box the font fills behind
+// them, so a frame never renders text or allocates. One that didn't fit, or
+// is past the table (100,000 ft and up), is rendered and copied as the frame
+// is drawn.
+//
+// draw() copies the window of the texture over the tape columns and drops the
+// labels on top: one row copy per row and two or three label copies, instead
+// of fillSprite, up to 19 wide lines and 4 smooth-font strings.
+class AltTape
+{
+public:
+    static const int PERIOD      = 49;  // rows per 200 ft
+    static const int LABEL_COUNT = 200; // "000" .. "995"
+
+    bool enabled = true;
+
+    // width: tape columns to compose, the part of altSprite on screen.
+    // labelSprite: scratch sprite for rendering labels, with altSprite's font, colours and datum.
+    bool begin(int16_t width, LGFX_Sprite *labelSprite);
+    bool valid() const { return _ticks.getBuffer() != nullptr; }
+
+    // Marks and labels for curAlt (>= 0) over the first width columns of dst.
+    void draw(const PixelSurface &dst, float curAlt);
+
+    // The same, starting from what the last drawScrolled() left in dst: while the tape
+    // moves by less than half its height it is scrolled in place and only the
+    // rows that came into view, plus rows dirtyTop..dirtyBottom-1 that
+    // something else drew over since, are composed again.
+    void drawScrolled(const PixelSurface &dst, float curAlt, int32_t dirtyTop, int32_t dirtyBottom);
+
+    // dst was drawn over by something else; the next drawScrolled() redraws it all.
+    void invalidate() { _drawn = false; }
+
+    // One mark and one label exactly as drawAltTape() draws them; used by the direct path too.
+    static int32_t markY(float curAlt, int alt) { return (int32_t)(ALT_TAPE_REFERENCE_Y + (curAlt - alt) * ALT_TAPE_PX_PER_FT); }
+    static void    drawMark(LGFX_Sprite &sprite, int32_t y);
+    static void    drawLabel(LGFX_Sprite &sprite, int alt, int32_t y);
+
+    unsigned long hits    = 0;
+    unsigned long misses  = 0; // labels not in the table, rendered in the frame
+    unsigned long scrolls = 0; // drawScrolled() frames that scrolled
+    unsigned long redraws = 0; // drawScrolled() frames that drew everything
+    bool          moved   = false; // the last drawScrolled() changed rows other than the dirty ones
+    size_t        bytes() const { return _bytes; }
+    int           entries() const { return _entries; }
+
+private:
+    void      capture(int alt, int32_t y);
+    RunImage *render(int index);
+    void      drawDirect(const PixelSurface &dst, int alt, int32_t y);
+    void      place(float curAlt, int &alt0, int32_t &even, int32_t &phase);
+    void      composeRows(const PixelSurface &dst, int32_t y0, int32_t y1, int32_t even, int32_t phase) const;
+    void      finish(const PixelSurface &dst, float curAlt);
+
+    LGFX_Sprite  _ticks;             // [2 * PERIOD] rows: phase 0, then phase 1
+    LGFX_Sprite *_label   = nullptr;
+    Pixel       *_capture = nullptr; // first of the two label captures
+    RunImage   **_images  = nullptr; // [LABEL_COUNT], null where one didn't fit
+    size_t       _bytes   = 0;
+    int          _entries = 0;
+    int          _alt0    = 0;     // the 200 ft mark last drawn
+    int32_t      _even    = 0;     // and its row
+    int32_t      _phase   = 0;
+    bool         _drawn   = false; // dst holds the last draw
+};
@@ -0,0 +1,41 @@
+#include "ISISAtlasFont.h"
+
+AtlasFont::AtlasFont(const AtlasFace &face, uint16_t fg, uint16_t bg) : _face(face)
+{
+    // Channels widened to 8 bits, blended, narrowed back to 565.
+    const int32_t fr = (fg >> 8) & 0xF8, fgr = (fg >> 3) & 0xFC, fb = (fg << 3) & 0xF8;
+    const int32_t br = (bg >> 8) & 0xF8, bgr = (bg >> 3) & 0xFC, bb = (bg << 3) & 0xF8;
+    for (int32_t a = 0; a < 16; a++) {
+        int32_t r  = br + (fr - br) * a / 15;
+        int32_t g  = bgr + (fgr - bgr) * a / 15;
+        int32_t b  = bb + (fb - bb) * a / 15;
+        _ink565[a] = (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+        _ink[a]    = pixelColor(_ink565[a]);
+    }
+}
+
+const AtlasGlyph *AtlasFont::glyph(uint16_t code) const
+{
+    for (int i = 0; i < _face.count; i++)
+        if (_face.glyphs[i].code == code) return &_face.glyphs[i];
+    return nullptr;
+}
+
+int32_t AtlasFont::drawString(const PixelSurface &dst, const char *text, int32_t x, int32_t y) const
+{
+    return forEachPixel(text, x, y, dst.width, dst.height, [&](int32_t px, int32_t py, uint8_t level) {
+        Pixel *out = dst.row(py) + px;
+        *out       = _ink[level];
+        ISIS_COUNT_PIXELS(out, 1);
+    });
+}
+
+int32_t AtlasFont::textWidth(const char *text) const
+{
+    int32_t w = 0;
+    for (; *text; text++) {
+        const AtlasGlyph *g = glyph((uint8_t)*text);
+        if (g) w += g->advance;
+    }
+    return w;
+}
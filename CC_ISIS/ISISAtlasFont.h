@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ISISBlit.h"
+
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+// Subsetted, pre-scaled fonts written by Scripts/VlwToHeader.py --atlas.
+//
+// A VLW font carries every glyph of its range at one size; loadFont() parses
+// it and each character is scaled and alpha-blended pixel by pixel through
+// LovyanGFX. An atlas face holds only the characters one readout needs, already
+// at its text size, as 4-bit alpha (two pixels a byte, rows packed, each glyph
+// from a byte boundary). Drawing one is a table lookup per pixel.
+
+struct AtlasGlyph {
+    uint16_t code;
+    uint8_t  w, h;   // box size
+    int8_t   dx, dy; // box offset from the cursor, top of the line at dy 0
+    uint8_t  advance;
+    uint16_t offset; // into the face's bitmap
+};
+
+struct AtlasFace {
+    const AtlasGlyph *glyphs; // by code
+    uint8_t           count;
+    const uint8_t    *bitmap;
+    int16_t           height; // line height at this size, as fontHeight()
+};
+
+// One face in one colour. The 15 partial levels are blended with bg
+// beforehand, so text drawn with it must go over bg; level 0 is left alone.
+class AtlasFont
+{
+public:
+    // fg, bg: RGB565, as the TFT_* constants.
+    AtlasFont(const AtlasFace &face, uint16_t fg, uint16_t bg);
+
+    const AtlasGlyph *glyph(uint16_t code) const;
+
+    // Top left of the line at (x, y). Characters not in the face are skipped. Return the width.
+    int32_t drawString(const PixelSurface &dst, const char *text, int32_t x, int32_t y) const;
+    int32_t textWidth(const char *text) const;
+    int16_t height() const { return _face.height; }
+
+    // The same on any sprite: ISIS_COLOR_DEPTH ones through the buffer, others a pixel at a time.
+    template <typename Sprite>
+    int32_t drawOnSprite(Sprite &sprite, const char *text, int32_t x, int32_t y) const
+    {
+        if (sprite.getColorDepth() == ISIS_COLOR_DEPTH) return drawString(surfaceOf(sprite), text, x, y);
+        return forEachPixel(text, x, y, sprite.width(), sprite.height(),
+                            [&](int32_t px, int32_t py, uint8_t level) { sprite.drawPixel(px, py, _ink565[level]); });
+    }
+
+private:
+    // Call plot(x, y, level) for every pixel of text with level > 0 inside width x height.
+    template <typename Plot>
+    int32_t forEachPixel(const char *text, int32_t x, int32_t y, int32_t width, int32_t height, Plot plot) const
+    {
+        const int32_t start = x;
+        for (; *text; text++) {
+            const AtlasGlyph *g = glyph((uint8_t)*text);
+            if (!g) continue;
+
+            const uint8_t *bits = _face.bitmap + g->offset;
+            const int32_t  gx   = x + g->dx;
+            uint32_t       n    = 0; // nibble index in the glyph
+            for (int32_t r = 0; r < g->h; r++) {
+                const int32_t py = y + g->dy + r;
+                if (py < 0 || py >= height) {
+                    n += g->w;
+                    continue;
+                }
+                for (int32_t c = 0; c < g->w; c++, n++) {
+                    uint8_t level = (n & 1) ? bits[n >> 1] & 0x0F : bits[n >> 1] >> 4;
+                    int32_t px    = gx + c;
+                    if (level && px >= 0 && px < width) plot(px, py, level);
+                }
+            }
+            x += g->advance;
+        }
+        return x - start;
+    }
+
+    const AtlasFace &_face;
+    Pixel            _ink[16];
+    uint16_t         _ink565[16];
+};
@@ -0,0 +1,103 @@
+#include "ISISBands.h"
+#include "ISISBlit.h"
+#include "ISISPresent.h"
+
+// How far split() moves toward the balanced row each frame: over a few frames, not after every one.
+static const float ADJUST_GAIN = 0.25f;
+
+bool BandRenderer::begin(int32_t rows, int32_t minRows)
+{
+    _rows    = rows;
+    _minRows = minRows;
+    _split   = rows / 2;
+    _target  = (float)_split;
+    _stop    = false;
+    // Next to the uploads, which are done before the frame's first band starts.
+    TaskHandle_t task;
+    if (xTaskCreatePinnedToCore(workerTask, "isisBand", STACK, this, 2, &task, 1 - ISIS_RENDER_CORE) != pdPASS) return false;
+    _worker = task;
+    return true;
+}
+
+void BandRenderer::end()
+{
+    if (!_worker) return;
+    _stop = true;
+    xTaskNotifyGive(_worker);
+    while (_worker) vTaskDelay(1);
+}
+
+void BandRenderer::workerTask(void *arg)
+{
+    BandRenderer *self = (BandRenderer *)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (self->_stop) break;
+        if (self->_done == self->_started) continue;
+
+        const unsigned long start = micros();
+#if defined(ISIS_PERF_STATS) || defined(ISIS_BENCHMARK) || defined(ISIS_OVERDRAW)
+        const uint32_t pixels = blitPixelsWritten();
+#endif
+        self->_draw(self->_context, self->_split, self->_rows);
+#if defined(ISIS_PERF_STATS) || defined(ISIS_BENCHMARK) || defined(ISIS_OVERDRAW)
+        self->_therePixels = blitPixelsWritten() - pixels;
+#endif
+        self->_thereUs = micros() - start;
+        self->_done    = self->_started;
+
+        TaskHandle_t waiter = self->_waiter;
+        if (waiter) xTaskNotifyGive(waiter);
+    }
+    self->_worker = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void BandRenderer::draw(Draw draw, void *context)
+{
+    const unsigned long start = micros();
+    _draw              = draw;
+    _context           = context;
+    _waiter            = xTaskGetCurrentTaskHandle();
+    const uint32_t seq = ++_started;
+    xTaskNotifyGive(_worker);
+
+    draw(context, 0, _split);
+    const uint32_t hereUs = micros() - start;
+
+    while ((int32_t)(_done - seq) < 0) ulTaskNotifyTake(pdTRUE, 1); // the tick covers a notification given just before
+    _waiter = nullptr;
+    elapsed.add(micros() - start);
+#if defined(ISIS_PERF_STATS) || defined(ISIS_BENCHMARK) || defined(ISIS_OVERDRAW)
+    blitPixelsWritten() += _therePixels;
+#endif
+
+    const uint32_t thereUs = _thereUs;
+    here.add(hereUs);
+    there.add(thereUs);
+    imbalance.add(hereUs > thereUs ? hereUs - thereUs : thereUs - hereUs);
+    bandRows.add(_split);
+    adjust(hereUs, thereUs);
+}
+
+// Move split() toward the row where, at what each band's rows cost this frame, both take as long.
+void BandRenderer::adjust(uint32_t hereUs, uint32_t thereUs)
+{
+    // The extra microsecond keeps an empty-looking band from counting as free.
+    const float hereRow  = (hereUs + 1) / (float)_split;
+    const float thereRow = (thereUs + 1) / (float)(_rows - _split);
+    const float balanced = _rows * thereRow / (hereRow + thereRow);
+
+    _target += (balanced - _target) * ADJUST_GAIN;
+    _target = constrain(_target, (float)_minRows, (float)(_rows - _minRows));
+    _split  = (int32_t)lroundf(_target);
+}
+
+void BandRenderer::resetStats()
+{
+    here      = PerfSample();
+    there     = PerfSample();
+    elapsed   = PerfSample();
+    imbalance = PerfSample();
+    bandRows  = PerfSample();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISPerf.h"
+
+// Draws the rows of a frame stage in two horizontal bands at once, one on
+// each core.
+//
+// draw() hands rows [split(), rows) to a task on the core not drawing the
+// frames and draws [0, split()) itself, then waits for the other band. The
+// draw function is given the band's rows; everything it draws has to be
+// clipped to them (surfaceRows(), ISISBlit.h), so a line or label crossing the
+// boundary is drawn by both and each keeps its own part.
+//
+// Rows don't cost the same (the ladder and labels sit around the horizon), so
+// after every frame the boundary moves toward where both bands would have
+// taken as long, from what each took per row.
+class BandRenderer
+{
+public:
+    typedef void (*Draw)(void *context, int32_t top, int32_t bottom);
+
+    // rows: the height to split. Neither band gets fewer than minRows.
+    bool begin(int32_t rows, int32_t minRows);
+    // End the worker task, waiting for it, so begin() can start another.
+    void end();
+    bool running() const { return _worker != nullptr; }
+
+    // Draw rows [0, rows) in the two bands and return when both are done.
+    void draw(Draw draw, void *context);
+
+    int32_t split() const { return _split; }
+
+    PerfSample here;      // us drawing the top band, on this core
+    PerfSample there;     // us drawing the bottom band, on the other
+    PerfSample elapsed;   // us from handing over the bottom band to both being done
+    PerfSample imbalance; // us one core waited for the other
+    PerfSample bandRows;  // split() per frame
+
+    // Both bands' time over the time they took together: 2.00 for no loss at all, in hundredths.
+    unsigned long speedup() const { return elapsed.total ? (here.total + there.total) * 100 / elapsed.total : 0; }
+
+    void resetStats();
+
+private:
+    static const uint32_t STACK = 4096; // the stages draw from caches; nothing is rendered with a font
+
+    static void workerTask(void *arg);
+    void        adjust(uint32_t hereUs, uint32_t thereUs);
+
+    volatile TaskHandle_t _worker      = nullptr; // cleared by the task as it ends
+    volatile bool         _stop        = false;
+    volatile TaskHandle_t _waiter      = nullptr;
+    Draw                  _draw        = nullptr;
+    void                 *_context     = nullptr;
+    int32_t               _rows        = 0;
+    int32_t               _minRows     = 0;
+    int32_t               _split       = 0;
+    float                 _target      = 0.0f; // split() before rounding
+    volatile uint32_t     _started     = 0;    // bottom bands handed over
+    volatile uint32_t     _done        = 0;    // and drawn
+    volatile uint32_t     _thereUs     = 0;
+    volatile uint32_t     _therePixels = 0; // ISIS_COUNT_PIXELS on the other core, added to this one's
+};
@@ -0,0 +1,654 @@
+#pragma once
+
+// Raw-buffer drawing helpers for the ISIS render paths.
+//
+// LovyanGFX is convenient but every primitive goes through clipping, colour
+// conversion and a per-call setup. The hot ISIS stages write large, simple
+// areas (spans, copies) into sprites, so these helpers work directly on the
+// sprite buffer instead. They are plain C++ (no Arduino / LovyanGFX
+// dependency), so the host build in host/ runs them on a desktop.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <utility>
+
+// Large, long-lived render data (caches, textures) goes to PSRAM on the device.
+#ifdef ARDUINO
+#include <esp32-hal-psram.h>
+#define ISIS_PSRAM_MALLOC(size) ps_malloc(size)
+#else
+#define ISIS_PSRAM_MALLOC(size) malloc(size)
+#endif
+
+// A view onto a row-major pixel buffer. stride is in pixels, so a view can
+// also describe a sub-rectangle of a larger buffer.
+template <typename T>
+struct Surface {
+    T      *pixels = nullptr;
+    int32_t width  = 0;
+    int32_t height = 0;
+    int32_t stride = 0;
+
+    T *row(int32_t y) const { return pixels + y * stride; }
+};
+
+// Rows [top, bottom) of s as a surface of their own. Drawing at row y - top in it
+// is drawing at row y in s, clipped to those rows.
+template <typename T>
+inline Surface<T> surfaceRows(const Surface<T> &s, int32_t top, int32_t bottom)
+{
+    Surface<T> band = s;
+    band.pixels     = s.row(top);
+    band.height     = bottom - top;
+    return band;
+}
+
+// The pixel format of every sprite, the back buffer and the panel. RGB332 by
+// default. With -DISIS_RGB565 it is the panel's own 16 bits, stored the way
+// LovyanGFX keeps 16-bit sprites and the Sprites/*.h images are: byte-swapped.
+// That costs twice the memory and memory traffic, and saves the conversion
+// on the way in from the images and out to the 16-bit panel.
+#ifdef ISIS_RGB565
+typedef uint16_t Pixel;
+#define ISIS_COLOR_DEPTH 16
+#else
+typedef uint8_t Pixel;
+#define ISIS_COLOR_DEPTH 8
+#endif
+
+// With -DISIS_PALETTE the RGB332 bytes are indices instead: drawing is the
+// same, but the flip looks each one up in a palette (ISISPalette.h) on its way
+// to a 16-bit panel.
+#ifdef ISIS_PALETTE
+#ifdef ISIS_RGB565
+#error "ISIS_PALETTE indexes 8-bit pixels; build it without ISIS_RGB565"
+#endif
+#define ISIS_PANEL_DEPTH 16
+#else
+#define ISIS_PANEL_DEPTH ISIS_COLOR_DEPTH
+#endif
+
+typedef Surface<Pixel> PixelSurface;
+
+// Visible columns [x0, x1) of one row. A table of these, one per row, describes
+// a non-rectangular window such as the rounded ISIS attitude area. Helpers that
+// take a mask never write outside it; nullptr means the whole surface.
+struct RowSpan {
+    int16_t x0;
+    int16_t x1;
+};
+
+// Narrow [x0, x1) to row y of mask.
+inline void clipToMask(const RowSpan *mask, int32_t y, int32_t &x0, int32_t &x1)
+{
+    if (!mask) return;
+    if (x0 < mask[y].x0) x0 = mask[y].x0;
+    if (x1 > mask[y].x1) x1 = mask[y].x1;
+}
+
+// Pixels written by the helpers in this file, for the render statistics.
+// ISIS_COUNT_PIXELS(p, n) reports n pixels written on one row from p. Compiled
+// out unless statistics, benchmarks or overdraw tracking (ISISOverdraw.h) are enabled.
+// Counted per thread: the attitude bands (ISISBands.h) draw on both cores at once.
+#if defined(ISIS_PERF_STATS) || defined(ISIS_BENCHMARK) || defined(ISIS_OVERDRAW)
+inline uint32_t &blitPixelsWritten()
+{
+    static thread_local uint32_t count = 0;
+    return count;
+}
+#ifdef ISIS_OVERDRAW
+void overdrawSpan(const uint8_t *p, int32_t count);
+#define ISIS_COUNT_PIXELS(p, n) (blitPixelsWritten() += (uint32_t)(n), overdrawSpan((const uint8_t *)(p), (n)))
+#else
+#define ISIS_COUNT_PIXELS(p, n) (blitPixelsWritten() += (uint32_t)(n))
+#endif
+#else
+#define ISIS_COUNT_PIXELS(p, n) ((void)0)
+#endif
+
+// View of an LGFX_Sprite of ISIS_COLOR_DEPTH. Templated so this header does
+// not need LovyanGFX.
+template <typename Sprite>
+inline PixelSurface surfaceOf(Sprite &sprite)
+{
+    PixelSurface s;
+    s.pixels = (Pixel *)sprite.getBuffer();
+    s.width  = sprite.width();
+    s.height = sprite.height();
+    s.stride = sprite.width();
+    return s;
+}
+
+// RGB565 (as used by the TFT_* constants) to the RGB332 byte stored in an
+// 8-bit sprite. Same truncation LovyanGFX applies when drawing a 565 colour.
+constexpr uint8_t color332(uint16_t rgb565)
+{
+    return ((rgb565 >> 8) & 0xE0) | ((rgb565 >> 6) & 0x1C) | ((rgb565 >> 3) & 0x03);
+}
+
+// Byte-swapped RGB565, as found in the Sprites/*.h image headers, to RGB332.
+constexpr uint8_t color332Swapped(uint16_t swapped565)
+{
+    return color332((uint16_t)((swapped565 >> 8) | (swapped565 << 8)));
+}
+
+// RGB565 (as the TFT_* constants) to a Pixel.
+constexpr Pixel pixelColor(uint16_t rgb565)
+{
+#ifdef ISIS_RGB565
+    return (Pixel)((rgb565 >> 8) | (rgb565 << 8));
+#else
+    return color332(rgb565);
+#endif
+}
+
+// Byte-swapped RGB565 (the Sprites/*.h images) to a Pixel.
+constexpr Pixel imagePixel(uint16_t swapped565)
+{
+#ifdef ISIS_RGB565
+    return swapped565;
+#else
+    return color332Swapped(swapped565);
+#endif
+}
+
+// A Sprites/*.h image as Pixels, converted by the compiler so it is stored
+// ready to copy into a sprite.
+template <size_t N>
+struct ImagePixels {
+    Pixel data[N];
+};
+
+template <size_t N, size_t... I>
+constexpr ImagePixels<N> imagePixels(const uint16_t (&src)[N], uint16_t key, Pixel keyOut, std::index_sequence<I...>)
+{
+    return { { (src[I] == key ? keyOut : imagePixel(src[I]))... } };
+}
+
+// Pixels equal to key become keyOut.
+template <size_t N>
+constexpr ImagePixels<N> imagePixels(const uint16_t (&src)[N], uint16_t key, Pixel keyOut)
+{
+    return imagePixels(src, key, keyOut, std::make_index_sequence<N>());
+}
+
+template <typename T>
+inline void fillRun(T *dst, int32_t count, T value)
+{
+    while (count-- > 0) *dst++ = value;
+}
+
+template <>
+inline void fillRun<uint8_t>(uint8_t *dst, int32_t count, uint8_t value)
+{
+    if (count > 0) memset(dst, value, count);
+}
+
+// Fill columns [x0, x1) of row, if any.
+template <typename T>
+inline void fillSpan(T *row, int32_t x0, int32_t x1, T value)
+{
+    if (x1 <= x0) return;
+    fillRun(row + x0, x1 - x0, value);
+    ISIS_COUNT_PIXELS(row + x0, x1 - x0);
+}
+
+// Copy rows srcTop .. srcTop + dst.height of src into dst, e.g. the visible
+// window of a pre-rendered tape. Rows outside src are filled with fill.
+// Both surfaces must be the same width. Only dst rows y0..y1-1 are written.
+inline void blitWindow(const PixelSurface &dst, const PixelSurface &src, int32_t srcTop, Pixel fill, int32_t y0 = 0, int32_t y1 = INT32_MAX)
+{
+    if (y0 < 0) y0 = 0;
+    if (y1 > dst.height) y1 = dst.height;
+    for (int32_t y = y0; y < y1; y++) {
+        int32_t sy = srcTop + y;
+        if (sy >= 0 && sy < src.height) {
+            memcpy(dst.row(y), src.row(sy), dst.width * sizeof(Pixel));
+            ISIS_COUNT_PIXELS(dst.row(y), dst.width);
+        } else {
+            fillSpan(dst.row(y), 0, dst.width, fill);
+        }
+    }
+}
+
+// Move columns [x0, x1) of every row by delta rows: row y takes what was in
+// row y + delta. The rows left behind keep their old contents. Full-width
+// rows of a packed surface go in one memmove.
+inline void scrollRows(const PixelSurface &dst, int32_t delta, int32_t x0, int32_t x1)
+{
+    const int32_t rows = dst.height - (delta < 0 ? -delta : delta);
+    if (delta == 0 || rows <= 0 || x1 <= x0) return;
+
+    if (x0 == 0 && x1 == dst.width && dst.stride == dst.width) {
+        Pixel *to = delta > 0 ? dst.row(0) : dst.row(-delta);
+        memmove(to, delta > 0 ? dst.row(delta) : dst.row(0), rows * dst.stride * sizeof(Pixel));
+        ISIS_COUNT_PIXELS(to, rows * dst.stride);
+        return;
+    }
+
+    // Row by row, in the order that never overwrites a row before it has moved.
+    for (int32_t i = 0; i < rows; i++) {
+        int32_t y = delta > 0 ? i : dst.height - 1 - i;
+        memmove(dst.row(y) + x0, dst.row(y + delta) + x0, (x1 - x0) * sizeof(Pixel));
+        ISIS_COUNT_PIXELS(dst.row(y) + x0, x1 - x0);
+    }
+}
+
+// blitWindow() for a window that was at srcTop - delta last time and is still
+// in dst: scroll what is already there and copy in only the rows that came into view.
+inline void scrollWindow(const PixelSurface &dst, const PixelSurface &src, int32_t srcTop, int32_t delta, Pixel fill)
+{
+    if (delta >= dst.height || -delta >= dst.height) {
+        blitWindow(dst, src, srcTop, fill);
+        return;
+    }
+    scrollRows(dst, delta, 0, dst.width);
+    if (delta > 0)
+        blitWindow(dst, src, srcTop, fill, dst.height - delta, dst.height);
+    else
+        blitWindow(dst, src, srcTop, fill, 0, -delta);
+}
+
+// Bresenham line, same stepping as LGFX drawLine(), clipped to the surface and mask.
+inline void drawSurfaceLine(const PixelSurface &s, int32_t x0, int32_t y0, int32_t x1, int32_t y1, Pixel color, const RowSpan *mask = nullptr)
+{
+    if (y0 == y1) {
+        if (y0 < 0 || y0 >= s.height) return;
+        int32_t lo = x0 < x1 ? x0 : x1;
+        int32_t hi = (x0 < x1 ? x1 : x0) + 1;
+        if (lo < 0) lo = 0;
+        if (hi > s.width) hi = s.width;
+        clipToMask(mask, y0, lo, hi);
+        fillSpan(s.row(y0), lo, hi, color);
+        return;
+    }
+
+    auto swap = [](int32_t &a, int32_t &b) {
+        int32_t t = a;
+        a         = b;
+        b         = t;
+    };
+
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        swap(x0, y0);
+        swap(x1, y1);
+    }
+    if (x0 > x1) {
+        swap(x0, x1);
+        swap(y0, y1);
+    }
+
+    int32_t dx    = x1 - x0;
+    int32_t dy    = abs(y1 - y0);
+    int32_t err   = dx >> 1;
+    int32_t ystep = (y0 < y1) ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        int32_t px = steep ? y0 : x0;
+        int32_t py = steep ? x0 : y0;
+        if (px >= 0 && px < s.width && py >= 0 && py < s.height && (!mask || (px >= mask[py].x0 && px < mask[py].x1))) {
+            s.row(py)[px] = color;
+            ISIS_COUNT_PIXELS(s.row(py) + px, 1);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+// Fill a surface with sky above and ground below a banked horizon line,
+// one row at a time.
+//
+// The horizon row for column x is round(centerY + (x - centerX) * tanBank),
+// exactly what the old per-column drawFastVLine loop used, and ground is
+// every pixel at or below it. That row is monotonic in x, so on each scanline
+// the ground is a single run at one end of the row. Walking down the rows the
+// sky/ground boundary column only ever moves one way, so it is stepped along
+// incrementally and each column's horizon row is evaluated exactly once.
+// Every scanline is then one sky run and one ground run, clipped to mask.
+//
+// s may be rows top.. of the surface centerY is in (surfaceRows()): the rows
+// are rounded there, so each band of rows is filled exactly as its part of the whole.
+template <typename T>
+void fillHorizon(const Surface<T> &s, float centerX, float centerY, float tanBank, T sky, T ground, const RowSpan *mask = nullptr,
+                 int32_t top = 0)
+{
+    const int32_t w = s.width;
+    const int32_t h = s.height;
+
+    // Horizon row of column x, clamped to 0..h. 0 = all ground, h = all sky.
+    auto horizonRow = [&](int32_t x) -> int32_t {
+        float y = centerY + (x - centerX) * tanBank;
+        if (y <= (float)top) return 0;
+        if (y >= (float)(top + h)) return h;
+        int32_t r = (int32_t)roundf(y) - top;
+        return r > h ? h : r;
+    };
+
+    if (tanBank >= 0.0f) {
+        // Horizon descends to the right: ground is the run [0, edge).
+        int32_t edge = 0;
+        int32_t next = horizonRow(0);
+        for (int32_t y = 0; y < h; y++) {
+            while (edge < w && next <= y) {
+                edge++;
+                if (edge < w) next = horizonRow(edge);
+            }
+            int32_t lo = 0, hi = w;
+            clipToMask(mask, y, lo, hi);
+            T *p = s.row(y);
+            fillSpan(p, lo, edge < hi ? edge : hi, ground);
+            fillSpan(p, edge > lo ? edge : lo, hi, sky);
+        }
+    } else {
+        // Horizon rises to the right: ground is the run [edge, w).
+        int32_t edge = w;
+        int32_t next = horizonRow(w - 1);
+        for (int32_t y = 0; y < h; y++) {
+            while (edge > 0 && next <= y) {
+                edge--;
+                if (edge > 0) next = horizonRow(edge - 1);
+            }
+            int32_t lo = 0, hi = w;
+            clipToMask(mask, y, lo, hi);
+            T *p = s.row(y);
+            fillSpan(p, lo, edge < hi ? edge : hi, sky);
+            fillSpan(p, edge > lo ? edge : lo, hi, ground);
+        }
+    }
+}
+
+// Quarter-turn case of blitRotated(): turn = 0..3 for 0/90/180/270°.
+// The mapping from destination to source is then an integer flip and/or
+// transpose, so each row is a straight pointer walk through src.
+inline void blitQuarterTurn(const PixelSurface &dst, const PixelSurface &src, float pivotX, float pivotY, float dstX, float dstY, int turn,
+                            Pixel key, const RowSpan *mask = nullptr)
+{
+    // sx = ox + ax * x + bx * y, sy = oy + ay * x + by * y
+    int32_t ox, oy, ax, bx, ay, by;
+    switch (turn) {
+    case 0:
+        ox = (int32_t)floorf(pivotX - dstX + 0.5f), ax = 1, bx = 0;
+        oy = (int32_t)floorf(pivotY - dstY + 0.5f), ay = 0, by = 1;
+        break;
+    case 1:
+        ox = (int32_t)floorf(pivotX - dstY + 0.5f), ax = 0, bx = 1;
+        oy = (int32_t)floorf(pivotY + dstX - 0.5f), ay = -1, by = 0;
+        break;
+    case 2:
+        ox = (int32_t)floorf(pivotX + dstX - 0.5f), ax = -1, bx = 0;
+        oy = (int32_t)floorf(pivotY + dstY - 0.5f), ay = 0, by = -1;
+        break;
+    default:
+        ox = (int32_t)floorf(pivotX + dstY - 0.5f), ax = 0, bx = -1;
+        oy = (int32_t)floorf(pivotY - dstX + 0.5f), ay = 1, by = 0;
+        break;
+    }
+
+    // Range of x for which base + step * x stays inside [0, limit).
+    auto clip = [](int32_t base, int32_t step, int32_t limit, int32_t &x0, int32_t &x1) {
+        if (step > 0) {
+            x0 = x0 > -base ? x0 : -base;
+            x1 = x1 < limit - base ? x1 : limit - base;
+        } else if (step < 0) {
+            x0 = x0 > base - limit + 1 ? x0 : base - limit + 1;
+            x1 = x1 < base + 1 ? x1 : base + 1;
+        } else if (base < 0 || base >= limit) {
+            x1 = x0;
+        }
+    };
+
+    const int32_t step = ax + ay * src.stride;
+    for (int32_t y = 0; y < dst.height; y++) {
+        int32_t sx = ox + bx * y;
+        int32_t sy = oy + by * y;
+        int32_t x0 = 0, x1 = dst.width;
+        clip(sx, ax, src.width, x0, x1);
+        clip(sy, ay, src.height, x0, x1);
+        clipToMask(mask, y, x0, x1);
+        if (x0 >= x1) continue;
+
+        const Pixel *p   = src.row(sy + ay * x0) + sx + ax * x0;
+        Pixel       *out = dst.row(y);
+        for (int32_t x = x0; x < x1; x++, p += step) {
+            Pixel v = *p;
+            if (v != key) {
+                out[x] = v;
+                ISIS_COUNT_PIXELS(out + x, 1);
+            }
+        }
+    }
+}
+
+// Rotated copy of a surface with a transparent key, used instead of
+// LGFX pushRotated() for the sprites rotated every frame.
+//
+// src is turned by angle degrees (clockwise on screen) about (pivotX, pivotY)
+// and that point lands on (dstX, dstY). Each destination pixel centre is mapped
+// back into src. The range of x whose sample falls inside src is solved for
+// every row first, so only the rotated footprint is visited, and the inner
+// loop steps the source position in Q16 fixed point.
+inline void blitRotated(const PixelSurface &dst, const PixelSurface &src, float pivotX, float pivotY, float dstX, float dstY, float angle,
+                        Pixel key, const RowSpan *mask = nullptr)
+{
+    float a = fmodf(angle, 360.0f);
+    if (a < 0.0f) a += 360.0f;
+    int32_t turn = (int32_t)lroundf(a / 90.0f);
+    if (fabsf(a - turn * 90.0f) < 0.001f) {
+        blitQuarterTurn(dst, src, pivotX, pivotY, dstX, dstY, turn & 3, key, mask);
+        return;
+    }
+
+    const float rad = a * 3.14159265f / 180.0f;
+    const float c   = cosf(rad);
+    const float s   = sinf(rad);
+    const float w   = (float)src.width;
+    const float h   = (float)src.height;
+
+    // Rows covered by the rotated source rectangle.
+    float minY = 1e9f, maxY = -1e9f;
+    for (int i = 0; i < 4; i++) {
+        float px = ((i & 1) ? w : 0.0f) - pivotX;
+        float py = ((i & 2) ? h : 0.0f) - pivotY;
+        float y  = dstY + px * s + py * c;
+        minY     = y < minY ? y : minY;
+        maxY     = y > maxY ? y : maxY;
+    }
+    int32_t y0 = (int32_t)floorf(minY);
+    int32_t y1 = (int32_t)ceilf(maxY);
+    if (y0 < 0) y0 = 0;
+    if (y1 > dst.height) y1 = dst.height;
+
+    // Narrow [lo, hi) so that 0 <= base + k * d < limit for every d in it.
+    auto clip = [](float base, float k, float limit, float &lo, float &hi) {
+        if (fabsf(k) < 1e-6f) {
+            if (base < 0.0f || base >= limit) hi = lo;
+            return;
+        }
+        float d0 = -base / k;
+        float d1 = (limit - base) / k;
+        if (k < 0.0f) {
+            float t = d0;
+            d0      = d1;
+            d1      = t;
+        }
+        lo = d0 > lo ? d0 : lo;
+        hi = d1 < hi ? d1 : hi;
+    };
+
+    const int32_t stepU = (int32_t)lroundf(c * 65536.0f);
+    const int32_t stepV = (int32_t)lroundf(-s * 65536.0f);
+
+    for (int32_t y = y0; y < y1; y++) {
+        // Source position of the pixel centre at dx = x + 0.5 - dstX:
+        //   u = pivotX + dx * c + dy * s,  v = pivotY - dx * s + dy * c
+        float dy    = y + 0.5f - dstY;
+        float baseU = pivotX + dy * s;
+        float baseV = pivotY + dy * c;
+
+        float lo = -1e9f, hi = 1e9f;
+        clip(baseU, c, w, lo, hi);
+        clip(baseV, -s, h, lo, hi);
+        if (lo >= hi) continue;
+
+        int32_t x0 = (int32_t)ceilf(lo + dstX - 0.5f);
+        int32_t x1 = (int32_t)ceilf(hi + dstX - 0.5f);
+        if (x0 < 0) x0 = 0;
+        if (x1 > dst.width) x1 = dst.width;
+        clipToMask(mask, y, x0, x1);
+        if (x0 >= x1) continue;
+
+        float   dx = x0 + 0.5f - dstX;
+        int32_t u  = (int32_t)lroundf((baseU + dx * c) * 65536.0f);
+        int32_t v  = (int32_t)lroundf((baseV - dx * s) * 65536.0f);
+
+        Pixel *out = dst.row(y);
+        for (int32_t x = x0; x < x1; x++, u += stepU, v += stepV) {
+            // Rounding at the span ends can land a fraction outside; the unsigned compare catches it.
+            uint32_t sx = (uint32_t)(u >> 16);
+            uint32_t sy = (uint32_t)(v >> 16);
+            if (sx >= (uint32_t)src.width || sy >= (uint32_t)src.height) continue;
+            Pixel p = src.row(sy)[sx];
+            if (p != key) {
+                out[x] = p;
+                ISIS_COUNT_PIXELS(out + x, 1);
+            }
+        }
+    }
+}
+
+// An image stored as runs of opaque pixels, row by row. Transparent
+// pixels cost nothing to store or draw, and drawing is one memcpy per run
+// with no per-pixel key test.
+//
+// originX/originY place the image relative to the point it is drawn at, so an
+// image captured around a pivot can be drawn at the pivot position.
+class RunImage
+{
+public:
+    struct Run {
+        uint16_t x;
+        uint16_t len;
+    };
+    struct Row {
+        uint16_t firstRun; // index into runs; the row's runs end at the next row's firstRun
+        uint32_t offset;   // index into pixels of the row's first opaque pixel
+    };
+
+    int16_t width   = 0;
+    int16_t height  = 0;
+    int16_t originX = 0;
+    int16_t originY = 0;
+
+    RunImage() {}
+    ~RunImage() { free(_block); }
+    RunImage(const RunImage &)            = delete;
+    RunImage &operator=(const RunImage &) = delete;
+
+    // Encode w x h pixels from src. Pixels equal to key are transparent.
+    bool encode(const Pixel *src, int32_t w, int32_t h, int32_t stride, Pixel key)
+    {
+        return encodeWhere(src, w, h, stride, [=](int32_t i) { return src[i] != key; });
+    }
+
+    // Encode the same drawing captured over two different backgrounds: pixels that
+    // came out the same both times are opaque, taken from a.
+    bool encodeCapture(const Pixel *a, const Pixel *b, int32_t w, int32_t h, int32_t stride)
+    {
+        return encodeWhere(a, w, h, stride, [=](int32_t i) { return a[i] == b[i]; });
+    }
+
+    // Draw with the image origin at (x, y), clipped to the surface and mask.
+    void draw(const PixelSurface &dst, int32_t x, int32_t y, const RowSpan *mask = nullptr) const
+    {
+        if (!_block) return;
+        x += originX;
+        y += originY;
+
+        int32_t row0 = y < 0 ? -y : 0;
+        int32_t row1 = (y + height > dst.height) ? dst.height - y : height;
+        for (int32_t row = row0; row < row1; row++) {
+            int32_t lo = 0, hi = dst.width;
+            clipToMask(mask, y + row, lo, hi);
+
+            Pixel       *out = dst.row(y + row);
+            const Pixel *px  = _pixels + _rows[row].offset;
+            for (uint32_t r = _rows[row].firstRun; r < _rows[row + 1].firstRun; r++) {
+                int32_t sx  = _runs[r].x;
+                int32_t len = _runs[r].len;
+                int32_t dx  = x + sx;
+                int32_t skip = dx < lo ? lo - dx : 0;
+                if (dx + len > hi) len = hi - dx;
+                if (len > skip) {
+                    memcpy(out + dx + skip, px + skip, (len - skip) * sizeof(Pixel));
+                    ISIS_COUNT_PIXELS(out + dx + skip, len - skip);
+                }
+                px += _runs[r].len;
+            }
+        }
+    }
+
+    bool   valid() const { return _block != nullptr; }
+    size_t bytes() const { return _bytes; }
+
+private:
+    // opaque(i) tells whether src[i] (i = y * stride + x) is part of the image.
+    template <typename Opaque>
+    bool encodeWhere(const Pixel *src, int32_t w, int32_t h, int32_t stride, Opaque opaque)
+    {
+        free(_block);
+        _block = nullptr;
+
+        // First pass: count runs and opaque pixels so everything fits in one allocation.
+        uint32_t runCount = 0, pixelCount = 0;
+        for (int32_t y = 0; y < h; y++) {
+            const int32_t i = y * stride;
+            for (int32_t x = 0; x < w; x++) {
+                if (!opaque(i + x)) continue;
+                if (x == 0 || !opaque(i + x - 1)) runCount++;
+                pixelCount++;
+            }
+        }
+        if (runCount > UINT16_MAX) return false;
+
+        _bytes = sizeof(Row) * (h + 1) + sizeof(Run) * runCount + pixelCount * sizeof(Pixel);
+        _block = (uint8_t *)ISIS_PSRAM_MALLOC(_bytes);
+        if (!_block) return false;
+
+        _rows   = (Row *)_block;
+        _runs   = (Run *)(_rows + h + 1);
+        _pixels = (Pixel *)(_runs + runCount);
+        width   = w;
+        height  = h;
+
+        uint32_t r = 0, o = 0;
+        for (int32_t y = 0; y < h; y++) {
+            const int32_t i = y * stride;
+            _rows[y]        = { (uint16_t)r, o };
+            int32_t x       = 0;
+            while (x < w) {
+                if (!opaque(i + x)) {
+                    x++;
+                    continue;
+                }
+                int32_t start = x;
+                while (x < w && opaque(i + x)) x++;
+                _runs[r++] = { (uint16_t)start, (uint16_t)(x - start) };
+                memcpy(_pixels + o, src + i + start, (x - start) * sizeof(Pixel));
+                o += x - start;
+            }
+        }
+        _rows[h] = { (uint16_t)r, o };
+        return true;
+    }
+
+    uint8_t *_block  = nullptr;
+    size_t   _bytes  = 0;
+    Row     *_rows   = nullptr;
+    Run     *_runs   = nullptr;
+    Pixel   *_pixels = nullptr;
+};
@@ -1,4 +1,5 @@
 #include "ISISCommon.h"
+#include "ISISSnapshot.h"
 
 LGFX lcd = LGFX();
 
@@ -253,16 +254,45 @@ bool loadSettings()
     }
 }
 
-bool saveSettings()
+static TaskHandle_t               settingsOwner = nullptr;
+static Seqlock<CC_ISIS_Settings> settingsHandedOver;
+static uint32_t                  settingsWritten = 0; // settingsHandedOver.version() last written
+
+static bool writeSettings(const CC_ISIS_Settings &settings)
 {
     bool retval;
 
-    retval = MFeeprom.write_block(CC_ISIS_SETTINGS_OFFSET, isisSettings);
+    retval = MFeeprom.write_block(CC_ISIS_SETTINGS_OFFSET, settings);
     if (retval) MFeeprom.commit();
     //  ESP_LOGV("PREF", "Settings saved. retval: %d\n", retval);
     return retval;
 }
 
+bool saveSettings()
+{
+    if (settingsOwner && xTaskGetCurrentTaskHandle() != settingsOwner) {
+        settingsHandedOver.publish(isisSettings);
+        return true;
+    }
+    return writeSettings(isisSettings);
+}
+
+void settingsBegin()
+{
+    settingsOwner = xTaskGetCurrentTaskHandle();
+}
+
+void settingsFlush()
+{
+    // A hand-over between version() and read() is written now and again next time: harmless.
+    const uint32_t version = settingsHandedOver.version();
+    if (version == settingsWritten) return;
+    CC_ISIS_Settings settings;
+    settingsHandedOver.read(settings);
+    settingsWritten = version;
+    writeSettings(settings);
+}
+
 //   uint8_t brightnessGamma(int percent)
 //   {
 //       if (percent < 1) percent = 1;
@@ -362,60 +392,70 @@ void CC_ISIS_Base::sendButton(String name, int pushType)
     cmdMessenger.sendCmdEnd();
 }
 
-// CC_ISIS_Base::setCommon() handles the message IDs shared by all device types (HSI, PFD, ISIS).
-void CC_ISIS_Base::setCommon(int16_t messageID, char *setPoint)
+// The common messages that only set a field of the flight state, into state. False for the others.
+bool setCommonData(ISISState &state, int16_t messageID, const char *setPoint)
 {
-    // Wake the display when data arrives, but only if MF is managing power.
-    // (PowerControl::ALWAYS_ON is handled inside powerStateSet itself.)
-    if (messageID > 0 && isisSettings.powerControl == PowerControl::DEVICE_MANAGED)
-        powerStateSet(PowerState::POWER_ON);
-
     switch (messageID) {
-
-    case -2: // PowerSavingMode: 1 = enter power saving, 0 = wake up
-        if (atoi(setPoint) == 1)
-            powerStateSet(PowerState::SHUTTING_DOWN);
-        else
-            powerStateSet(PowerState::POWER_ON);
-        break;
-
-    case -1: // Stop message from MF — device execution stops
-        powerStateSet(PowerState::SHUTTING_DOWN);
-        break;
-
     case 0: // AP Heading Bug
-        isisState.headingBugAngle = atoi(setPoint);
+        state.headingBugAngle = atoi(setPoint);
         break;
     case 1: // Approach Type
-        isisState.gpsApproachType = atoi(setPoint);
+        state.gpsApproachType = atoi(setPoint);
         break;
     case 2: // CDI Lateral Deviation
-        isisState.rawCdiOffset = atof(setPoint);
+        state.rawCdiOffset = atof(setPoint);
         break;
     case 3: // CDI Needle Valid
-        isisState.cdiNeedleValid = atoi(setPoint);
+        state.cdiNeedleValid = atoi(setPoint);
         break;
     case 4: // CDI To/From Flag
-        isisState.cdiToFrom = atoi(setPoint);
+        state.cdiToFrom = atoi(setPoint);
         break;
     case 5: // Glide Slope Deviation
-        isisState.rawGsiNeedle = atof(setPoint);
+        state.rawGsiNeedle = atof(setPoint);
         break;
     case 6: // Glide Slope Needle Valid
-        isisState.gsiNeedleValid = atoi(setPoint);
+        state.gsiNeedleValid = atoi(setPoint);
         break;
     case 7: // Ground Speed
-        isisState.groundSpeed = atoi(setPoint);
+        state.groundSpeed = atoi(setPoint);
         break;
     case 8: // Ground Track (Magnetic)
-        isisState.groundTrack = atof(setPoint);
+        state.groundTrack = atof(setPoint);
         break;
     case 9: // Heading (Magnetic)
-        isisState.rawHeadingAngle = atof(setPoint);
+        state.rawHeadingAngle = atof(setPoint);
         break;
     case 10: // Nav Source (1=GPS, 0=NAV)
-        isisState.navSource = atoi(setPoint);
+        state.navSource = atoi(setPoint);
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
+// CC_ISIS_Base::setCommon() handles the message IDs shared by all device types (HSI, PFD, ISIS).
+void CC_ISIS_Base::setCommon(int16_t messageID, char *setPoint)
+{
+    // Wake the display when data arrives, but only if MF is managing power.
+    // (PowerControl::ALWAYS_ON is handled inside powerStateSet itself.)
+    if (messageID > 0 && isisSettings.powerControl == PowerControl::DEVICE_MANAGED)
+        powerStateSet(PowerState::POWER_ON);
+
+    switch (messageID) {
+
+    case -2: // PowerSavingMode: 1 = enter power saving, 0 = wake up
+        if (atoi(setPoint) == 1)
+            powerStateSet(PowerState::SHUTTING_DOWN);
+        else
+            powerStateSet(PowerState::POWER_ON);
         break;
+
+    case -1: // Stop message from MF — device execution stops
+        powerStateSet(PowerState::SHUTTING_DOWN);
+        break;
+
     case 12: // Brightness (0-255)
         isisState.lcdBrightness = max(0, min(atoi(setPoint), 255));
         lcd.setBrightness(isisState.lcdBrightness);
@@ -444,5 +484,9 @@ void CC_ISIS_Base::setCommon(int16_t messageID, char *setPoint)
         }
         saveSettings();
         break;
+
+    default: // flight data
+        setCommonData(isisState, messageID, setPoint);
+        break;
     }
 }
\ No newline at end of file
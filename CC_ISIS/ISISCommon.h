@@ -24,7 +24,7 @@
 #define PIf                  3.14159f
 
 #define CC_ISIS_SETTINGS_OFFSET 2048 // Well past MF config end (59 + 1496 = 1555)
-#define SETTINGS_VERSION        7    // Bumped: removed HSI/PFD fields from CC_ISIS_Settings
+#define SETTINGS_VERSION        11   // Bumped: dropped pixelClockHz
 #define STATE_VERSION         1
 
 #define TFT_MAIN_TRANSPARENT TFT_PINK // Just pick a color not used in either display
@@ -45,6 +45,8 @@ struct CC_ISIS_Settings {
     uint8_t      tempUnits     = 0; // 0: F, 1: C
     uint8_t      lcdBrightness = 100;
     PowerControl powerControl  = PowerControl::ALWAYS_ON;
+    uint8_t      displayTheme  = 0;  // 0: day, 1: night (message 104, ISISPalette.h)
+    uint8_t      frameRate     = 30; // frames per second the scheduler paces to (message 105); 0: unpaced
 };
 
 extern CC_ISIS_Settings isisSettings;
@@ -136,12 +138,18 @@ void  drawShutdown(LGFX_Sprite *targetSprite);
 void  drawBattery(LGFX_Sprite *targetSprite, int x, int y);
 
 bool powerStateSet(PowerState ps);
+bool setCommonData(ISISState &state, int16_t messageID, const char *setPoint);
 
 uint8_t brightnessGamma(int percent);
 
 extern MFEEPROM MFeeprom;
 bool            loadSettings();
 bool            saveSettings();
+// The EEPROM belongs to the task that calls settingsBegin() (the Arduino loop), with MobiFlight's own
+// config. After that, saveSettings() on any other task only hands the settings over, and
+// settingsFlush() on the owner writes them.
+void            settingsBegin();
+void            settingsFlush();
 
 // Selection option for popup menus
 struct SelectionOption {
@@ -0,0 +1,69 @@
+#include "ISISDamage.h"
+
+void Damage::setBounds(int32_t width, int32_t height)
+{
+    _width  = width;
+    _height = height;
+    _count  = 0;
+}
+
+void Damage::add(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (x < 0) w += x, x = 0;
+    if (y < 0) h += y, y = 0;
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return;
+
+    DamageRect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    for (int i = 0; i < _count; i++) {
+        const DamageRect &o = _rects[i];
+        if (r.x >= o.x && r.y >= o.y && r.x + r.w <= o.x + o.w && r.y + r.h <= o.y + o.h) return; // already covered
+    }
+    if (_count == MAX_RECTS) {
+        for (int i = 1; i < _count; i++) merge(_rects[0], _rects[i]);
+        merge(_rects[0], r);
+        _count = 1;
+        return;
+    }
+    _rects[_count++] = r;
+}
+
+bool Damage::shouldMerge(const DamageRect &a, const DamageRect &b)
+{
+    const int32_t x0 = a.x < b.x ? a.x : b.x, x1 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+    const int32_t y0 = a.y < b.y ? a.y : b.y, y1 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+    const int32_t box      = (x1 - x0) * (y1 - y0);
+    const int32_t together = (int32_t)a.w * a.h + (int32_t)b.w * b.h;
+    const bool    overlap  = a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    return overlap || box <= together + together / 4;
+}
+
+void Damage::merge(DamageRect &a, const DamageRect &b)
+{
+    const int16_t x0 = a.x < b.x ? a.x : b.x, x1 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+    const int16_t y0 = a.y < b.y ? a.y : b.y, y1 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+    a = { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+}
+
+void Damage::coalesce()
+{
+    // A merge can make its box overlap one already passed, so go again until nothing merges.
+    for (bool merged = true; merged;) {
+        merged = false;
+        for (int i = 0; i < _count; i++)
+            for (int j = i + 1; j < _count; j++) {
+                if (!shouldMerge(_rects[i], _rects[j])) continue;
+                merge(_rects[i], _rects[j]);
+                _rects[j--] = _rects[--_count];
+                merged      = true;
+            }
+    }
+}
+
+uint32_t Damage::area() const
+{
+    uint32_t a = 0;
+    for (int i = 0; i < _count; i++) a += (uint32_t)_rects[i].w * _rects[i].h;
+    return a;
+}
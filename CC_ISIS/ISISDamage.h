@@ -0,0 +1,51 @@
+#pragma once
+
+// Damage tracking for the pushes to the panel.
+//
+// The panel keeps what was last pushed, so a sprite only needs pushing where
+// it changed since. Each render stage adds the rectangles it changed; the
+// presenter pushes just those, clipped, instead of the whole sprite. Nearby
+// rectangles are merged first, as every push costs a setup besides its
+// pixels, and the rows of a merged rectangle are still contiguous runs in the
+// sprite.
+//
+// Plain C++ with no Arduino / LovyanGFX dependency; host/ builds and checks it
+// on a desktop.
+
+#include <stdint.h>
+
+struct DamageRect {
+    int16_t x, y, w, h;
+};
+
+class Damage
+{
+public:
+    static const int MAX_RECTS = 6; // past this everything is merged into one box
+
+    // The part of the sprite that is on screen; rectangles are clipped to it.
+    void setBounds(int32_t width, int32_t height);
+
+    void add(int32_t x, int32_t y, int32_t w, int32_t h);
+    void addAll() { add(0, 0, _width, _height); }
+    void clear() { _count = 0; }
+
+    // Merge rectangles that overlap, or whose bounding box is not much more
+    // than they are together.
+    void coalesce();
+
+    bool              empty() const { return _count == 0; }
+    int               count() const { return _count; }
+    const DamageRect &rect(int i) const { return _rects[i]; }
+    uint32_t          area() const; // pixels, counting overlaps twice
+    uint32_t          fullArea() const { return (uint32_t)_width * _height; }
+
+private:
+    static bool shouldMerge(const DamageRect &a, const DamageRect &b);
+    static void merge(DamageRect &a, const DamageRect &b);
+
+    DamageRect _rects[MAX_RECTS];
+    int        _count  = 0;
+    int16_t    _width  = 0;
+    int16_t    _height = 0;
+};
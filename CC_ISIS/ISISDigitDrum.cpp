@@ -0,0 +1,60 @@
+#include "ISISDigitDrum.h"
+
+bool DigitDrum::begin(int16_t width, int16_t cellHeight, int16_t cells, Pixel background)
+{
+    _cellHeight = cellHeight;
+    _cellCount  = cells;
+    _background = background;
+
+    _cells.setColorDepth(ISIS_COLOR_DEPTH);
+    if (!_cells.createSprite(width, cellHeight * cells)) return false;
+    fillRun((Pixel *)_cells.getBuffer(), (int32_t)(_cells.bufferLength() / sizeof(Pixel)), background);
+    return true;
+}
+
+void DigitDrum::draw(const PixelSurface &dst, int32_t x, int32_t top, int32_t bottom, int32_t currentTop, int current, int next,
+                     int32_t key) const
+{
+    const Pixel *cells = (const Pixel *)_cells.getBuffer();
+    if (!cells || x < 0) return;
+    if (current >= _cellCount) current = BLANK;
+    if (next >= _cellCount) next = BLANK;
+
+    const int32_t w = min((int32_t)_cells.width(), dst.width - x);
+    if (top < 0) top = 0;
+    if (bottom > dst.height) bottom = dst.height;
+
+    for (int32_t y = top; y < bottom; y++) {
+        int32_t k    = y - currentTop;
+        int     cell = BLANK;
+        if (k >= 0 && k < _cellHeight) {
+            cell = current;
+        } else if (k < 0 && k >= -_cellHeight) {
+            cell = next;
+            k += _cellHeight;
+        }
+
+        Pixel *out = dst.row(y) + x;
+        if (cell == BLANK) {
+            if (key < 0) fillSpan(dst.row(y), x, x + w, _background);
+            continue;
+        }
+
+        const Pixel *src = cells + (cell * _cellHeight + k) * _cells.width();
+        if (key < 0) {
+            memcpy(out, src, w * sizeof(Pixel));
+            ISIS_COUNT_PIXELS(out, w);
+            continue;
+        }
+        for (int32_t i = 0; i < w;) {
+            if (src[i] == key) {
+                i++;
+                continue;
+            }
+            int32_t start = i;
+            while (i < w && src[i] != key) i++;
+            memcpy(out + start, src + start, (i - start) * sizeof(Pixel));
+            ISIS_COUNT_PIXELS(out + start, i - start);
+        }
+    }
+}
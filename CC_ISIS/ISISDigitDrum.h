@@ -0,0 +1,35 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+
+// One column of a rolling counter, pre-rendered.
+//
+// The glyphs are drawn once into a stack of equal cells, each at the same spot
+// in its cell. A frame copies the rows of the column from the cell being shown
+// and the one rolling in directly above it, so rolling is a row offset and no
+// font is rendered in the loop.
+class DigitDrum
+{
+public:
+    static const int BLANK = -1; // no glyph: background, or nothing when keyed
+
+    bool begin(int16_t width, int16_t cellHeight, int16_t cells, Pixel background);
+    bool valid() const { return _cells.getBuffer() != nullptr; }
+
+    // Draw cell i into this at rows cellTop(i) .. cellTop(i) + cellHeight - 1.
+    LGFX_Sprite &canvas() { return _cells; }
+    int16_t      cellTop(int i) const { return i * _cellHeight; }
+
+    // Rows top..bottom-1 of the column at x in dst: cell current from row
+    // currentTop down, cell next directly above it. With key >= 0 only pixels
+    // other than key are copied.
+    void draw(const PixelSurface &dst, int32_t x, int32_t top, int32_t bottom, int32_t currentTop, int current, int next,
+              int32_t key = -1) const;
+
+private:
+    LGFX_Sprite _cells;
+    int16_t     _cellHeight = 0;
+    int16_t     _cellCount  = 0;
+    Pixel       _background = 0;
+};
@@ -0,0 +1,136 @@
+#include "ISISDigitFont.h"
+
+const char DigitFont::GLYPHS[] = "0123456789.-STDNEG";
+
+int DigitFont::glyphIndex(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    for (int i = 10; i < GLYPH_COUNT; i++)
+        if (GLYPHS[i] == c) return i;
+    return -1;
+}
+
+bool DigitFont::begin(LGFX_Sprite *scratch, float textSize, uint32_t fg, uint32_t bg)
+{
+    const Pixel key = pixelColor(bg);
+    scratch->setTextSize(textSize);
+    scratch->setTextColor(fg);
+    scratch->setTextDatum(TL_DATUM);
+
+    // The cursor sits in from the corner in case a glyph reaches left of or above it.
+    const int32_t  cx = 4, cy = 4;
+    const int32_t  sw = scratch->width(), sh = scratch->height();
+    const Pixel   *canvas = (const Pixel *)scratch->getBuffer();
+    char           text[3] = { 0, '0', 0 };
+
+    _valid = false;
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        text[0] = GLYPHS[i];
+        text[1] = 0;
+        scratch->fillSprite(bg);
+        scratch->drawString(text, cx, cy);
+
+        // Encode only the box around what was drawn, not the empty rows and columns around it.
+        int32_t x0 = sw, y0 = sh, x1 = -1, y1 = -1;
+        for (int32_t y = 0; y < sh; y++)
+            for (int32_t x = 0; x < sw; x++) {
+                if (canvas[y * sw + x] == key) continue;
+                x0 = min(x0, x);
+                x1 = max(x1, x);
+                y0 = min(y0, y);
+                y1 = max(y1, y);
+            }
+        if (x1 < 0) x0 = x1 = cx, y0 = y1 = cy; // nothing drawn: one transparent pixel
+
+        RunImage &g = _glyphs[i];
+        if (!g.encode(canvas + y0 * sw + x0, x1 - x0 + 1, y1 - y0 + 1, sw, key)) return false;
+        g.originX = x0 - cx;
+        g.originY = y0 - cy;
+
+        // textWidth() of a last character may include its overhang, so measure it followed by a 0.
+        text[1]     = '0';
+        _advance[i] = scratch->textWidth(text) - scratch->textWidth("0");
+    }
+    _valid = true;
+    return true;
+}
+
+int DigitFont::formatInt(char *buf, long value)
+{
+    char         *p = buf;
+    unsigned long v = value < 0 ? 0UL - (unsigned long)value : (unsigned long)value;
+    if (value < 0) *p++ = '-';
+
+    char digits[24];
+    int  n = 0;
+    do {
+        digits[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    while (n) *p++ = digits[--n];
+    *p = 0;
+    return p - buf;
+}
+
+int DigitFont::formatFixed(char *buf, float value, int decimals, bool dropLeadingZero)
+{
+    double scale = 1.0;
+    for (int i = 0; i < decimals; i++) scale *= 10.0;
+
+    double        v      = fabs((double)value) * scale;
+    double        whole  = floor(v);
+    unsigned long scaled = (unsigned long)whole;
+    if (v - whole > 0.5 || (v - whole == 0.5 && (scaled & 1))) scaled++;
+
+    char *p = buf;
+    if (value < 0.0f) *p++ = '-';
+    unsigned long unit = (unsigned long)scale;
+    if (scaled / unit || !dropLeadingZero) p += formatInt(p, (long)(scaled / unit));
+    if (decimals > 0) {
+        *p++               = '.';
+        unsigned long frac = scaled % unit;
+        for (int i = decimals - 1; i >= 0; i--) {
+            p[i] = '0' + frac % 10;
+            frac /= 10;
+        }
+        p += decimals;
+    }
+    *p = 0;
+    return p - buf;
+}
+
+int32_t DigitFont::drawString(const PixelSurface &dst, const char *text, int32_t x, int32_t y) const
+{
+    const int32_t start = x;
+    for (; *text; text++) {
+        int i = glyphIndex(*text);
+        if (i < 0) continue;
+        _glyphs[i].draw(dst, x, y);
+        x += _advance[i];
+    }
+    return x - start;
+}
+
+int32_t DigitFont::drawNumber(const PixelSurface &dst, long value, int32_t x, int32_t y) const
+{
+    char buf[24];
+    formatInt(buf, value);
+    return drawString(dst, buf, x, y);
+}
+
+int32_t DigitFont::textWidth(const char *text) const
+{
+    int32_t w = 0;
+    for (; *text; text++) {
+        int i = glyphIndex(*text);
+        if (i >= 0) w += _advance[i];
+    }
+    return w;
+}
+
+size_t DigitFont::bytes() const
+{
+    size_t bytes = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++) bytes += _glyphs[i].bytes();
+    return bytes;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+
+// Pre-blended glyphs for the numeric readouts.
+//
+// The glyphs "0123456789.-STDNEG" are rendered once with a sprite's smooth
+// font at one text size, in one colour over one background, and each is kept
+// as a RunImage: the runs of pixels that differ from the background. A
+// readout is then a memcpy per run instead of sprintf plus a smooth-font
+// string that blends every pixel, and the background around and inside a
+// glyph is not drawn, so a glyph whose box overlaps its neighbour leaves it
+// alone. Text is laid out as with TL_DATUM: each glyph at the offset from
+// the cursor the font drew it at, the cursor moving on by its advance.
+//
+// The blend against the background is baked in, so this is only for text
+// drawn over that background.
+class DigitFont
+{
+public:
+    bool enabled = true;
+
+    // scratch: a sprite with the font loaded, big enough for one glyph; its text settings are changed.
+    bool begin(LGFX_Sprite *scratch, float textSize, uint32_t fg, uint32_t bg);
+    bool valid() const { return _valid; }
+
+    // What sprintf "%ld" / "%.Nf" would write (ties round to even, like printf),
+    // optionally without the 0 before the point. Return the length.
+    static int formatInt(char *buf, long value);
+    static int formatFixed(char *buf, float value, int decimals, bool dropLeadingZero);
+
+    // Top left at (x, y). Characters not in the atlas are skipped. Return the width.
+    int32_t drawString(const PixelSurface &dst, const char *text, int32_t x, int32_t y) const;
+    int32_t drawNumber(const PixelSurface &dst, long value, int32_t x, int32_t y) const;
+    int32_t textWidth(const char *text) const;
+
+    size_t bytes() const;
+
+private:
+    static const char GLYPHS[];
+    static const int  GLYPH_COUNT = 18;
+
+    static int glyphIndex(char c);
+
+    RunImage _glyphs[GLYPH_COUNT]; // origin at the glyph's offset from the cursor
+    int16_t  _advance[GLYPH_COUNT] = {};
+    bool     _valid                = false;
+};
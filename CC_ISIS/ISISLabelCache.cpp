@@ -0,0 +1,77 @@
+#include "ISISLabelCache.h"
+
+#include <new>
+
+void PitchLabelCache::begin(LGFX_Sprite *labelSprite)
+{
+    _label = labelSprite;
+
+    // Big enough for the label sprite rotated any way around its pivot.
+    int16_t px = max((int)_label->getPivotX(), _label->width() - (int)_label->getPivotX());
+    int16_t py = max((int)_label->getPivotY(), _label->height() - (int)_label->getPivotY());
+    _radius    = (int16_t)ceilf(sqrtf(px * px + py * py)) + 1;
+
+    _rotated.setColorDepth(ISIS_COLOR_DEPTH);
+    _rotated.createSprite(_radius * 2 + 1, _radius * 2 + 1);
+    _rotated.setPivot(_radius, _radius);
+
+    size_t tableSize = sizeof(RunImage *) * LABEL_COUNT * ANGLE_COUNT;
+    _images          = (RunImage **)ISIS_PSRAM_MALLOC(tableSize);
+    if (!_images) {
+        enabled = false;
+        return;
+    }
+    memset(_images, 0, tableSize);
+    _bytes = tableSize;
+
+    const unsigned long start = micros();
+    for (int label = 0; label < LABEL_COUNT; label++) {
+        for (int step = 0; step < ANGLE_COUNT; step++) {
+            RunImage *&entry = _images[label * ANGLE_COUNT + step];
+            entry            = render((label + 1) * 10, step);
+            if (!entry) break;
+        }
+    }
+    _fillUs = micros() - start;
+    enabled = ready();
+}
+
+RunImage *PitchLabelCache::render(int value, int step)
+{
+    char text[4];
+    sprintf(text, "%d", value);
+
+    // Exactly what drawAttitude() did per frame, but into a scratch sprite at a quantized angle.
+    _label->fillSprite(TFT_BLACK);
+    _label->drawString(text, 2, _label->height() / 2);
+    _rotated.fillSprite(TFT_BLACK);
+    _label->pushRotated(&_rotated, (float)(step - 90), TFT_BLACK);
+
+    void *mem = ISIS_PSRAM_MALLOC(sizeof(RunImage));
+    if (!mem) return nullptr;
+    RunImage *image = new (mem) RunImage();
+    if (!image->encode((const Pixel *)_rotated.getBuffer(), _rotated.width(), _rotated.height(), _rotated.width(), pixelColor(TFT_BLACK))) {
+        image->~RunImage();
+        free(mem);
+        return nullptr;
+    }
+    image->originX = -_radius;
+    image->originY = -_radius;
+
+    _bytes += sizeof(RunImage) + image->bytes();
+    _entries++;
+    return image;
+}
+
+void PitchLabelCache::draw(const PixelSurface &dst, int value, float angle, int16_t x, int16_t y, const RowSpan *mask) const
+{
+    if (!_images || value < 10 || value > 90) return;
+
+    while (angle > 180.0f) angle -= 360.0f;
+    while (angle <= -180.0f) angle += 360.0f;
+    int step = (int)lroundf(angle) + 90;
+    if (step < 0 || step >= ANGLE_COUNT) return;
+
+    const RunImage *image = _images[(value / 10 - 1) * ANGLE_COUNT + step];
+    if (image) image->draw(dst, x, y, mask);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+
+// Cache of the pitch ladder labels (10, 20 .. 90), pre-rendered and pre-rotated.
+//
+// Drawing a label used to be fillSprite + smooth-font drawString + pushRotated
+// with a transparent key, for up to four labels a frame. Here every label is
+// rendered at boot at every 1° bank step and kept in PSRAM as a RunImage, so a
+// frame never renders text: a label is one masked copy.
+//
+// Labels are drawn at bank (or bank + 180 when inverted), which always
+// normalises to -90..90, so there are 9 x 181 entries.
+//
+// Nothing is added after begin(), so the attitude bands (ISISBands.h) read the
+// cache from both cores without a lock. If it can't all be allocated, ready()
+// is false and the labels are drawn the old way.
+class PitchLabelCache
+{
+public:
+    static const int LABEL_COUNT = 9;
+    static const int ANGLE_COUNT = 181;
+
+    bool enabled = true;
+
+    // labelSprite: the sprite the labels are rendered in, with its font, colours and pivot set.
+    // Renders every entry, and turns enabled off if they didn't all fit.
+    void begin(LGFX_Sprite *labelSprite);
+    bool ready() const { return _entries == LABEL_COUNT * ANGLE_COUNT; }
+
+    // Draw label `value` (10..90) rotated by angle degrees, label pivot at (x, y).
+    void draw(const PixelSurface &dst, int value, float angle, int16_t x, int16_t y, const RowSpan *mask = nullptr) const;
+
+    size_t        bytes() const { return _bytes; }
+    int           entries() const { return _entries; }
+    unsigned long fillUs() const { return _fillUs; } // begin() rendering them all
+
+private:
+    RunImage *render(int value, int step);
+
+    LGFX_Sprite  *_label = nullptr;
+    LGFX_Sprite   _rotated;
+    int16_t       _radius  = 0;
+    RunImage    **_images  = nullptr; // [LABEL_COUNT * ANGLE_COUNT]
+    size_t        _bytes   = 0;
+    int           _entries = 0;
+    unsigned long _fillUs  = 0;
+};
@@ -0,0 +1,162 @@
+// Pixel write / overdraw instrumentation. Only built with -DISIS_OVERDRAW.
+
+#ifdef ISIS_OVERDRAW
+
+#include "ISISOverdraw.h"
+#include "ISISBlit.h"
+
+#include <stdio.h>
+
+OverdrawStats overdraw;
+
+// Called by ISIS_COUNT_PIXELS in ISISBlit.h.
+void overdrawSpan(const uint8_t *p, int32_t count)
+{
+    overdraw.span(p, count);
+}
+
+bool OverdrawStats::addSurface(const char *name, const uint8_t *pixels, int32_t width, int32_t height)
+{
+    if (_surfaceCount >= MAX_SURFACES || !pixels) return false;
+
+    Target &t = _surfaces[_surfaceCount];
+    t.frame   = (uint8_t *)ISIS_PSRAM_MALLOC(width * height);
+    t.total   = (uint16_t *)ISIS_PSRAM_MALLOC(width * height * sizeof(uint16_t));
+    if (!t.frame || !t.total) {
+        free(t.frame);
+        free(t.total);
+        t = Target();
+        return false;
+    }
+    memset(t.frame, 0, width * height);
+    memset(t.total, 0, width * height * sizeof(uint16_t));
+    t.name   = name;
+    t.pixels = pixels;
+    t.width  = width;
+    t.height = height;
+    _surfaceCount++;
+    return true;
+}
+
+void OverdrawStats::stage(const char *name)
+{
+    for (_stage = 0; _stage < _stageCount; _stage++)
+        if (_stages[_stage].name == name) return;
+
+    if (_stageCount < MAX_STAGES) {
+        _stages[_stageCount].name = name;
+        _stage                    = _stageCount++;
+    } else {
+        _stage = -1;
+    }
+}
+
+OverdrawStats::Target *OverdrawStats::find(const uint8_t *p)
+{
+    for (int i = 0; i < _surfaceCount; i++) {
+        Target &t = _surfaces[i];
+        if (p >= t.pixels && p < t.pixels + t.width * t.height * sizeof(Pixel)) return &t;
+    }
+    return nullptr;
+}
+
+void OverdrawStats::count(Target &t, uint32_t offset, int32_t n)
+{
+    uint32_t overdrawn = 0;
+    uint8_t *frame     = t.frame + offset;
+    for (int32_t i = 0; i < n; i++) {
+        if (frame[i]) overdrawn++;
+        if (frame[i] < UINT8_MAX) frame[i]++;
+    }
+
+    t.counts.written += n;
+    t.counts.overdrawn += overdrawn;
+    if (_stage >= 0) {
+        _stages[_stage].counts.written += n;
+        _stages[_stage].counts.overdrawn += overdrawn;
+    }
+}
+
+void OverdrawStats::span(const uint8_t *p, int32_t count)
+{
+    Target *t = find(p);
+    if (t && count > 0) this->count(*t, (p - t->pixels) / sizeof(Pixel), count);
+}
+
+void OverdrawStats::rect(const uint8_t *pixels, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    Target *t = find(pixels);
+    if (!t) return;
+
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > t->width) w = t->width - x;
+    if (y + h > t->height) h = t->height - y;
+    if (w <= 0 || h <= 0) return;
+
+    for (int32_t row = y; row < y + h; row++)
+        count(*t, row * t->width + x, w);
+}
+
+void OverdrawStats::pushed(const uint8_t *pixels)
+{
+    Target *t = find(pixels);
+    if (!t) return;
+
+    uint32_t size = t->width * t->height;
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t sum = t->total[i] + t->frame[i];
+        t->total[i]  = sum > UINT16_MAX ? UINT16_MAX : sum;
+    }
+    memset(t->frame, 0, size);
+
+    // The heatmap is averaged over frames, counted by the first surface's pushes.
+    if (t == &_surfaces[0]) _heatFrames++;
+}
+
+void OverdrawStats::resetCounts()
+{
+    for (int i = 0; i < _surfaceCount; i++) _surfaces[i].counts = Counts();
+    for (int i = 0; i < _stageCount; i++) _stages[i].counts = Counts();
+    _frames = 0;
+}
+
+bool OverdrawStats::writeHeatmap(int i, Writer write, void *context) const
+{
+    if (i < 0 || i >= _surfaceCount) return false;
+    const Target &t = _surfaces[i];
+
+    char header[32];
+    int  len = snprintf(header, sizeof(header), "P6\n%ld %ld\n255\n", (long)t.width, (long)t.height);
+    write(header, len, context);
+
+    // Colour ramp for 0, 1, 2, 3 and 4+ writes per frame.
+    static const uint8_t ramp[5][3] = { { 0, 0, 0 }, { 0, 0, 255 }, { 0, 200, 0 }, { 255, 255, 0 }, { 255, 0, 0 } };
+
+    uint32_t frames = _heatFrames ? _heatFrames : 1;
+    uint8_t  line[3 * 64];
+    int      used = 0;
+    for (int32_t p = 0; p < t.width * t.height; p++) {
+        float writes = (float)t.total[p] / frames;
+        int   lo     = writes >= 4.0f ? 4 : (int)writes;
+        int   hi     = lo < 4 ? lo + 1 : 4;
+        float f      = writes - lo;
+        if (f > 1.0f) f = 1.0f;
+        for (int c = 0; c < 3; c++)
+            line[used++] = (uint8_t)(ramp[lo][c] + (ramp[hi][c] - ramp[lo][c]) * f);
+        if (used == sizeof(line)) {
+            write(line, used, context);
+            used = 0;
+        }
+    }
+    if (used) write(line, used, context);
+    return true;
+}
+
+#endif
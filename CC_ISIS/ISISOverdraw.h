@@ -0,0 +1,98 @@
+#pragma once
+
+// Pixel write and overdraw instrumentation. Only built with -DISIS_OVERDRAW.
+//
+// Every sprite buffer the ISIS draws into is registered here. The raw helpers
+// in ISISBlit.h report each span they write; LovyanGFX primitives are reported
+// by their bounding box at the call site. Writes are counted per render stage
+// and per sprite. Each pixel also keeps a count for the current frame, so a
+// pixel written again before its sprite is pushed on counts as overdraw, and
+// the per-pixel totals make up a heatmap.
+//
+// Only the raw helpers' counts are exact. LovyanGFX primitives are counted by
+// the bounding box OVERDRAW_TEXT / OVERDRAW_RECT in CC_ISIS.cpp give them,
+// not by the pixels they actually write, so the per-stage and per-sprite
+// numbers for anything drawn with them are approximate.
+//
+// Plain C++ with no Arduino / LovyanGFX dependency. host/ builds it with the
+// raw helpers, replays frames through them and writes the heatmaps to files.
+
+#include <stddef.h>
+#include <stdint.h>
+
+class OverdrawStats
+{
+public:
+    static const int MAX_SURFACES = 6;
+    static const int MAX_STAGES   = 8;
+
+    struct Counts {
+        uint32_t written   = 0; // pixel writes
+        uint32_t overdrawn = 0; // writes to a pixel already written since the last push
+    };
+
+    // Track writes into a width x height buffer of Pixels (ISISBlit.h).
+    bool addSurface(const char *name, const uint8_t *pixels, int32_t width, int32_t height);
+
+    // Following writes belong to this stage. name must be a string literal.
+    void stage(const char *name);
+
+    // count pixels written on one row, starting at p. Untracked buffers are ignored.
+    void span(const uint8_t *p, int32_t count);
+    // A rectangle of the surface whose buffer is pixels, clipped to it.
+    void rect(const uint8_t *pixels, int32_t x, int32_t y, int32_t w, int32_t h);
+    // The surface was pushed to its destination: add its frame counts to the heatmap and start over.
+    void pushed(const uint8_t *pixels);
+    void endFrame() { _frames++; }
+
+    int         surfaceCount() const { return _surfaceCount; }
+    const char *surfaceName(int i) const { return _surfaces[i].name; }
+    Counts      surfaceCounts(int i) const { return _surfaces[i].counts; }
+    int         stageCount() const { return _stageCount; }
+    const char *stageName(int i) const { return _stages[i].name; }
+    Counts      stageCounts(int i) const { return _stages[i].counts; }
+    uint32_t    frames() const { return _frames; }
+
+    // Clear the counts and frame count. The heatmap keeps accumulating.
+    void resetCounts();
+
+    // Binary PPM (P6) of surface i: average writes per pixel per heatmap frame.
+    // Black = never written, blue = once, green = twice, yellow = three times,
+    // red = four or more, blended in between.
+    typedef void (*Writer)(const void *data, size_t len, void *context);
+    bool writeHeatmap(int i, Writer write, void *context) const;
+
+private:
+    struct Target {
+        const char    *name   = nullptr;
+        const uint8_t *pixels = nullptr;
+        int32_t        width  = 0;
+        int32_t        height = 0;
+        uint8_t       *frame  = nullptr; // writes since the last push, saturating
+        uint16_t      *total  = nullptr; // writes over all heatmap frames, saturating
+        Counts         counts;
+    };
+    struct Stage {
+        const char *name = nullptr;
+        Counts      counts;
+    };
+
+    Target  *find(const uint8_t *p);
+    void     count(Target &t, uint32_t offset, int32_t n);
+
+    Target   _surfaces[MAX_SURFACES];
+    Stage    _stages[MAX_STAGES];
+    int      _surfaceCount = 0;
+    int      _stageCount   = 0;
+    int      _stage        = -1;
+    uint32_t _frames       = 0;
+    uint32_t _heatFrames   = 0;
+};
+
+extern OverdrawStats overdraw;
+
+#ifdef ISIS_OVERDRAW
+#define OVERDRAW_STAGE(name) overdraw.stage(name)
+#else
+#define OVERDRAW_STAGE(name) ((void)0)
+#endif
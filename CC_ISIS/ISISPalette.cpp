@@ -0,0 +1,22 @@
+#include "ISISPalette.h"
+
+// Night: per channel, of 256. Sky stays blue and ground brown, so the horizon still reads.
+static const uint16_t NIGHT_R = 180;
+static const uint16_t NIGHT_G = 140;
+static const uint16_t NIGHT_B = 110;
+
+void Palette::build(Theme theme, uint8_t level)
+{
+    for (int c = 0; c < 256; c++) {
+        // Widened the way LovyanGFX shows an RGB332 pixel.
+        uint16_t r = ((c >> 5) * 0x49) >> 1;
+        uint16_t g = (((c >> 2) & 7) * 0x49) >> 1;
+        uint16_t b = (c & 3) * 0x55;
+        if (theme == NIGHT) {
+            r = r * NIGHT_R >> 8;
+            g = g * NIGHT_G >> 8;
+            b = b * NIGHT_B >> 8;
+        }
+        _colors[c] = lgfx::bgr888_t(r * level / 255, g * level / 255, b * level / 255);
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ISISCommon.h"
+
+// The colours the 8-bit pixels are shown in.
+//
+// Sprites, caches and the back buffer hold RGB332 codes (ISISBlit.h). With a
+// palette set on the presenter (FramePresenter::setPalette()) the codes are
+// indices: the flip looks each one up here on its way to the panel, which
+// -DISIS_PALETTE runs at 16 bits (so it needs -DISIS_DOUBLE_BUFFER, the flip
+// being the double-buffered one). A new table recolours the whole display on
+// the next flip with nothing drawn again. That gives
+//   - dimming below where the backlight stops (brightnessGamma() never goes
+//     under 40/255), by scaling every entry, and
+//   - a night theme, warmer and darker, with blue cut most.
+//
+// The ISIS draws a few dozen of the 256 codes, but antialiased text and the
+// images use others, so the table covers them all; entry c starts out as the
+// colour of code c.
+class Palette
+{
+public:
+    enum Theme : uint8_t { DAY   = 0,
+                           NIGHT = 1 };
+
+    // level: 0..255 of the theme's full brightness.
+    void build(Theme theme, uint8_t level);
+
+    const lgfx::bgr888_t *colors() const { return _colors; }
+
+private:
+    lgfx::bgr888_t _colors[256];
+};
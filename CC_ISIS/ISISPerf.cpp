@@ -0,0 +1,47 @@
+#include "ISISPerf.h"
+#include "commandmessenger.h"
+
+#include <stdarg.h>
+
+PerfStats perfStats;
+
+static const int      STATUS_LENGTH  = 96;
+static const int      STATUS_QUEUED  = 32; // lines; the benchmarks send a few dozen at once
+static const uint32_t STATUS_WAIT_MS = 100; // for the owner to make room, before a line is dropped
+
+static QueueHandle_t statusQueue   = nullptr;
+static TaskHandle_t  statusOwner   = nullptr;
+static uint32_t      statusDropped = 0;
+
+void perfStatus(const char *fmt, ...)
+{
+    char    buf[STATUS_LENGTH];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (statusQueue && xTaskGetCurrentTaskHandle() != statusOwner) {
+        if (xQueueSend(statusQueue, buf, pdMS_TO_TICKS(STATUS_WAIT_MS)) != pdTRUE) statusDropped++;
+        return;
+    }
+    cmdMessenger.sendCmd(kStatus, buf);
+}
+
+void perfStatusBegin()
+{
+    if (!statusQueue) statusQueue = xQueueCreate(STATUS_QUEUED, STATUS_LENGTH);
+    statusOwner = xTaskGetCurrentTaskHandle();
+}
+
+void perfStatusFlush()
+{
+    if (!statusQueue) return;
+    char buf[STATUS_LENGTH];
+    while (xQueueReceive(statusQueue, buf, 0) == pdTRUE) cmdMessenger.sendCmd(kStatus, buf);
+    if (statusDropped) {
+        snprintf(buf, sizeof(buf), "status: %lu lines dropped", (unsigned long)statusDropped);
+        statusDropped = 0;
+        cmdMessenger.sendCmd(kStatus, buf);
+    }
+}
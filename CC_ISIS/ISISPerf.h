@@ -0,0 +1,105 @@
+#pragma once
+#include <Arduino.h>
+#include <limits.h>
+
+// Performance instrumentation for the ISIS renderer.
+//
+// Nothing here costs anything in a normal build. Enable with build flags in
+// CC_ISIS_platformio.ini:
+//   -DISIS_BENCHMARK   Run the render A/B benchmarks once, shortly after boot.
+//                      Results are sent to the Connector log as kStatus messages.
+//   -DISIS_PERF_STATS  Time every frame and render stage, and report the timings and
+//                      cache statistics every ISIS_STATS_INTERVAL_MS.
+//   -DISIS_OVERDRAW    Count pixel writes and overdraw per stage and per sprite
+//                      (ISISOverdraw.h) and report them every ISIS_STATS_INTERVAL_MS.
+//   -DISIS_DAMAGE_OUTLINE  Outline in magenta, for one frame, each region pushed to
+//                      the panel (ISISDamage.h).
+
+#define ISIS_BENCHMARK_DELAY_MS 10000 // Give the Connector time to attach before reporting.
+#define ISIS_STATS_INTERVAL_MS  10000
+
+// printf-style status message to MobiFlight (shows up in the Connector log / serial monitor).
+void perfStatus(const char *fmt, ...);
+// cmdMessenger belongs to the task that calls perfStatusBegin() (the Arduino loop). After that, a
+// perfStatus() on any other task is queued, and sent by perfStatusFlush() on the owner.
+void perfStatusBegin();
+void perfStatusFlush();
+
+// Accumulates min / max / total of a repeated measurement in microseconds.
+struct PerfSample {
+    unsigned long count = 0;
+    unsigned long total = 0;
+    unsigned long min   = ULONG_MAX;
+    unsigned long max   = 0;
+
+    void add(unsigned long us)
+    {
+        count++;
+        total += us;
+        if (us < min) min = us;
+        if (us > max) max = us;
+    }
+    unsigned long avg() const { return count ? total / count : 0; }
+};
+
+// Counts a repeated measurement in microseconds into BUCKET_US wide buckets, for its percentiles.
+// Anything past the last bucket is counted in one more; its percentile is the largest seen.
+struct PerfHistogram {
+    static const int           BUCKETS   = 200;
+    static const unsigned long BUCKET_US = 250; // up to 50ms: a frame at 20 fps
+
+    unsigned long buckets[BUCKETS + 1] = {};
+    unsigned long count                = 0;
+    unsigned long max                  = 0;
+
+    void add(unsigned long us)
+    {
+        const unsigned long b = us / BUCKET_US;
+        buckets[b < BUCKETS ? b : BUCKETS]++;
+        count++;
+        if (us > max) max = us;
+    }
+    // The time percent of the measurements took no longer than, to the top of its bucket.
+    unsigned long percentile(unsigned percent) const
+    {
+        if (!count) return 0;
+        const unsigned long rank = (count * percent + 99) / 100;
+        unsigned long       seen = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            seen += buckets[b];
+            if (seen >= rank) return min((b + 1) * BUCKET_US, max);
+        }
+        return max;
+    }
+    void reset() { *this = PerfHistogram(); }
+};
+
+// Per-stage frame timings, reset after every report.
+struct PerfStats {
+    PerfSample frame;
+    PerfSample attitude;
+    PerfSample background;
+    PerfSample speedTape;
+    PerfSample altTape;
+    PerfSample readouts;
+    PerfSample attitudePixels; // pixels written into attSprite by attitude + overlays
+    PerfSample panelBytes;     // bytes pushed to the panel per frame
+    PerfSample panelBytesFull; // and what pushing every sprite whole would have been
+
+    void reset() { *this = PerfStats(); }
+};
+
+extern PerfStats perfStats;
+
+#ifdef ISIS_PERF_STATS
+// Adds the time until the end of the enclosing scope to a PerfSample.
+struct PerfScope {
+    PerfSample   &sample;
+    unsigned long start;
+    PerfScope(PerfSample &s) : sample(s), start(micros()) {}
+    ~PerfScope() { sample.add(micros() - start); }
+};
+#define PERF_SCOPE(sample) PerfScope perfScope_(sample)
+#else
+#define PERF_SCOPE(sample)
+#endif
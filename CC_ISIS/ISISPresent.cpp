@@ -0,0 +1,347 @@
+#include "ISISPresent.h"
+#include "ISISBlit.h"
+
+#include <driver/gpio.h>
+#include <soc/gpio_periph.h>
+
+FramePresenter framePresenter;
+
+void FramePresenter::begin(LovyanGFX *panel, int vsyncPin, bool vsyncIdleHigh, bool doubleBuffered)
+{
+    _panel = panel;
+    _damage.setBounds(panel->width(), panel->height());
+    _vsyncPin = vsyncPin;
+    _idleHigh = vsyncIdleHigh;
+    if (vsyncPin >= 0 && !watchVsync()) _vsyncPin = -1;
+    if (!doubleBuffered) return;
+#ifndef ISIS_PALETTE
+    if (_vsyncPin < 0) return; // nothing to flip on; a palette is shown through the back buffer regardless
+#endif
+
+    _back.setColorDepth(ISIS_COLOR_DEPTH); // the panel's, but for a palette's 16 bits
+    _back.setPsram(true);
+    if (!_back.createSprite(panel->width(), panel->height())) return;
+    _back.fillSprite(TFT_BLACK);
+    _lastVsyncs = _vsyncs;
+
+    startUploads(); // or upload() copies itself
+}
+
+bool FramePresenter::watchVsync()
+{
+    // The LCD peripheral drives the pad through the GPIO matrix. Only the pad's input is turned on, so
+    // the GPIO block sees the edges; gpio_set_direction() would take the pad from the peripheral.
+    PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[_vsyncPin]);
+    gpio_set_intr_type((gpio_num_t)_vsyncPin, _idleHigh ? GPIO_INTR_NEGEDGE : GPIO_INTR_POSEDGE);
+    esp_err_t err = gpio_install_isr_service(0); // already installed is fine
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) return false;
+    gpio_isr_handler_remove((gpio_num_t)_vsyncPin); // when watching again
+    if (gpio_isr_handler_add((gpio_num_t)_vsyncPin, onVsync, this) != ESP_OK) return false;
+    gpio_intr_enable((gpio_num_t)_vsyncPin);
+    return true;
+}
+
+void FramePresenter::unwatchVsync()
+{
+    gpio_intr_disable((gpio_num_t)_vsyncPin);
+    gpio_isr_handler_remove((gpio_num_t)_vsyncPin);
+    _vsyncPin = -1;
+}
+
+void FramePresenter::end()
+{
+    if (_uploads) {
+        waitUploads(_uploadsSent);
+        const Upload stop = {}; // no source: the task's signal to end
+        xQueueSend(_uploads, &stop, portMAX_DELAY);
+        while (_uploader) vTaskDelay(1);
+        vQueueDelete(_uploads);
+        _uploads = nullptr;
+    }
+    if (_vsyncPin >= 0) unwatchVsync();
+    _back.deleteSprite();
+    _damage.clear();
+    for (auto &f : _fences) f = {};
+}
+
+void FramePresenter::setTiming(uint32_t framePeriodUs, uint32_t lineUs)
+{
+    _lastVsyncUs = 0; // the interval across the change isn't either period
+    _periodUs    = framePeriodUs;
+    _toleranceUs = lineUs * 2;
+}
+
+int32_t FramePresenter::driftPpm(const PanelCounts &from, const PanelCounts &to) const
+{
+    const uint32_t intervals = to.intervals - from.intervals;
+    if (!intervals || !_periodUs) return 0;
+    return (int32_t)((int64_t)(to.driftUs - from.driftUs) * 1000000 / ((int64_t)intervals * _periodUs));
+}
+
+FramePresenter::PanelCounts FramePresenter::panelCounts() const
+{
+    PanelCounts c;
+    c.intervals = _intervals;
+    c.underruns = _underruns;
+    c.driftUs   = _driftUs;
+    c.late      = _totalLate;
+    c.timeouts  = _totalTimeouts;
+    return c;
+}
+
+bool FramePresenter::startUploads()
+{
+    _uploads = xQueueCreate(UPLOAD_QUEUE, sizeof(Upload));
+    if (!_uploads) return false;
+    // On the core not drawing the frames, over anything else there: with the render task that is the
+    // Arduino loop, taking in messages.
+    TaskHandle_t task;
+    if (xTaskCreatePinnedToCore(uploadTask, "isisUpload", 2048, this, 2, &task, 1 - ISIS_RENDER_CORE) != pdPASS) {
+        vQueueDelete(_uploads);
+        _uploads = nullptr;
+        return false;
+    }
+    _uploader = task;
+    return true;
+}
+
+void FramePresenter::uploadTask(void *arg)
+{
+    FramePresenter *self = (FramePresenter *)arg;
+    Upload          u;
+    for (;;) {
+        if (xQueueReceive(self->_uploads, &u, portMAX_DELAY) != pdTRUE) continue;
+        if (!u.src) break; // end()
+        const unsigned long start = micros();
+        for (int32_t r = 0; r < u.h; r++) memcpy(u.dst + r * u.dstStride, u.src + r * u.srcStride, u.w * sizeof(Pixel));
+        self->_uploadUs += micros() - start;
+        self->_uploadsDone++;
+        TaskHandle_t waiter = self->_uploadWaiter;
+        if (waiter) xTaskNotifyGive(waiter);
+    }
+    self->_uploader = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void FramePresenter::upload(LGFX_Sprite &sprite, int32_t x, int32_t y, const DamageRect &r)
+{
+    LovyanGFX    *frame = target();
+    const int32_t x0    = max(x + r.x, (int32_t)0);
+    const int32_t y0    = max(y + r.y, (int32_t)0);
+    const int32_t x1    = min(x + r.x + r.w, frame->width());
+    const int32_t y1    = min(y + r.y + r.h, frame->height());
+    if (x0 >= x1 || y0 >= y1) return;
+    damage(x0, y0, x1 - x0, y1 - y0);
+    pixelsUploaded += (x1 - x0) * (y1 - y0);
+
+    if (!asyncUploads || !_uploads || !doubleBuffered() || sprite.getColorDepth() != _back.getColorDepth()) {
+        frame->setClipRect(x0, y0, x1 - x0, y1 - y0);
+        sprite.pushSprite(frame, x, y);
+        frame->clearClipRect();
+        return;
+    }
+
+    const PixelSurface src = surfaceOf(sprite);
+    const PixelSurface dst = surfaceOf(_back);
+    Upload             u;
+    u.src       = src.row(y0 - y) + x0 - x;
+    u.dst       = dst.row(y0) + x0;
+    u.srcStride = src.stride;
+    u.dstStride = dst.stride;
+    u.w         = x1 - x0;
+    u.h         = y1 - y0;
+    if (xQueueSend(_uploads, &u, 0) != pdTRUE) { // full: wait for the other core
+        const unsigned long start = micros();
+        xQueueSend(_uploads, &u, portMAX_DELAY);
+        _waitUs += micros() - start;
+    }
+    const uint32_t seq = ++_uploadsSent;
+
+    // Remember it as the sprite's last upload, in its slot or one whose uploads are done.
+    int slot = -1;
+    for (int i = 0; i < FENCES; i++) {
+        if (_fences[i].sprite == &sprite) {
+            slot = i;
+            break;
+        }
+        if (slot < 0 && (!_fences[i].sprite || (int32_t)(_uploadsDone - _fences[i].seq) >= 0)) slot = i;
+    }
+    if (slot < 0) { // all busy: wait for them all
+        waitUploads(seq - 1);
+        slot = 0;
+    }
+    _fences[slot].sprite = &sprite;
+    _fences[slot].seq    = seq;
+}
+
+PixelSurface FramePresenter::surface(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    PixelSurface s;
+    if (!doubleBuffered() || _back.getColorDepth() != ISIS_COLOR_DEPTH) return s;
+    const PixelSurface back = surfaceOf(_back);
+    s.pixels                = back.row(y) + x;
+    s.width                 = w;
+    s.height                = h;
+    s.stride                = back.stride;
+    return s;
+}
+
+void FramePresenter::fence(const LGFX_Sprite &sprite)
+{
+    for (int i = 0; i < FENCES; i++)
+        if (_fences[i].sprite == &sprite) waitUploads(_fences[i].seq);
+}
+
+void FramePresenter::waitUploads(uint32_t seq)
+{
+    if ((int32_t)(_uploadsDone - seq) >= 0) return;
+    const unsigned long start = micros();
+    _uploadWaiter = xTaskGetCurrentTaskHandle();
+    while ((int32_t)(_uploadsDone - seq) < 0) ulTaskNotifyTake(pdTRUE, 1); // the tick covers a notification given just before
+    _uploadWaiter = nullptr;
+    _waitUs += micros() - start;
+}
+
+void IRAM_ATTR FramePresenter::onVsync(void *arg)
+{
+    FramePresenter *self = (FramePresenter *)arg;
+    self->_vsyncs++;
+
+    const uint32_t now = micros();
+    if (self->_periodUs && self->_lastVsyncUs) {
+        const int32_t error = (int32_t)(now - self->_lastVsyncUs - self->_periodUs);
+        self->_intervals++;
+        self->_driftUs += error;
+        if (error > (int32_t)self->_toleranceUs || error < -(int32_t)self->_toleranceUs) self->_underruns++;
+    }
+    self->_lastVsyncUs = now;
+    TaskHandle_t waiter = self->_waiter;
+    if (waiter) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(waiter, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+void FramePresenter::flip()
+{
+    flips++;
+    if (_uploads) {
+        waitUploads(_uploadsSent);
+        uploadTime.add(_uploadUs);
+        uploadWait.add(_waitUs);
+        _uploadUs = _waitUs = 0;
+    }
+    if (!doubleBuffered() || _damage.empty()) {
+        _damage.clear();
+        _lastVsyncs = _vsyncs + 1; // when a frame with changes would have gone up
+        return;
+    }
+    const unsigned long start = micros();
+
+    if (_vsyncPin >= 0) {
+        const uint32_t seen = _vsyncs;
+        _waiter = xTaskGetCurrentTaskHandle();
+        ulTaskNotifyTake(pdTRUE, 0); // drop a notification from before
+        while (_vsyncs == seen) {
+            if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(VSYNC_TIMEOUT_MS))) continue;
+            timeouts++;
+            _totalTimeouts++;
+            if (++_timeoutRun >= MAX_TIMEOUTS) {
+                _waiter = nullptr;
+                fallBack();
+                if (!doubleBuffered()) return;
+            }
+            break; // present it anyway
+        }
+        _waiter = nullptr;
+        if (_vsyncs != seen) _timeoutRun = 0;
+    }
+    // The last frame went up at _lastVsyncs to stay for _frameRefreshes; any more, this one is late.
+    const uint32_t presentedAt = _vsyncs;
+    const int32_t  shown       = (int32_t)(presentedAt - _lastVsyncs);
+    if (_vsyncPin >= 0 && shown > (int32_t)_frameRefreshes) missedVsyncs += shown - _frameRefreshes;
+
+    // The beam is in the vertical blanking. Copy in the order it scans, a strip of panel lines at a
+    // time, so each strip is written before the beam gets to it. Panel lines run along logical rows
+    // or columns, forwards or backwards, with the rotation.
+    const unsigned long copyStart = micros();
+    _damage.coalesce();
+    pixelsFlipped += _damage.area();
+    const uint8_t rotation = _panel->getRotation() & 3;
+    const bool    alongX   = rotation & 1;   // panel lines are logical columns
+    const bool    reverse  = rotation >= 2; // scanned from the right / bottom
+    const int32_t extent   = alongX ? _panel->width() : _panel->height();
+    for (int32_t band = 0; band < extent; band += SCAN_STRIP) {
+        const int32_t lo = reverse ? max(extent - band - SCAN_STRIP, (int32_t)0) : band;
+        const int32_t hi = reverse ? extent - band : min(band + SCAN_STRIP, extent);
+        for (int i = 0; i < _damage.count(); i++) {
+            const DamageRect &r  = _damage.rect(i);
+            const int32_t     r0 = max((int32_t)(alongX ? r.x : r.y), lo);
+            const int32_t     r1 = min((int32_t)(alongX ? r.x + r.w : r.y + r.h), hi);
+            if (r0 >= r1) continue;
+            if (alongX)
+                _panel->setClipRect(r0, r.y, r1 - r0, r.h);
+            else
+                _panel->setClipRect(r.x, r0, r.w, r1 - r0);
+            pushBack();
+        }
+    }
+    _panel->clearClipRect();
+    _damage.clear();
+
+    const unsigned long end = micros();
+    copyTime.add(end - copyStart);
+    latency.add(end - start);
+    if (_vsyncs != presentedAt) {
+        lateCopies++;
+        _totalLate++;
+    }
+    _lastVsyncs = presentedAt;
+}
+
+void FramePresenter::setPalette(const lgfx::bgr888_t *palette)
+{
+    _palette = sizeof(Pixel) == 1 ? palette : nullptr;
+    damageAll();
+}
+
+// The back buffer to the panel, within the panel's clip rectangle.
+void FramePresenter::pushBack()
+{
+    if (_palette)
+        _panel->pushImage(0, 0, _back.width(), _back.height(), _back.getBuffer(), lgfx::palette_8bit, _palette);
+    else
+        _back.pushSprite(_panel, 0, 0);
+}
+
+// Vsync isn't arriving: put the whole frame up and draw straight to the panel from now on. With a
+// palette the back buffer is the only way the frame gets its colours, so it stays and the flips go
+// on without waiting; they may tear.
+void FramePresenter::fallBack()
+{
+    unwatchVsync();
+    if (_palette) {
+        perfStatus("present: no vsync; flipping unsynced to keep the palette");
+        return;
+    }
+    perfStatus("present: no vsync; drawing straight to the panel");
+
+    pushBack();
+    _back.deleteSprite();
+    _damage.clear();
+}
+
+void FramePresenter::resetStats()
+{
+    latency        = PerfSample();
+    copyTime       = PerfSample();
+    uploadTime     = PerfSample();
+    uploadWait     = PerfSample();
+    flips          = 0;
+    missedVsyncs   = 0;
+    lateCopies     = 0;
+    timeouts       = 0;
+    pixelsUploaded = 0;
+    pixelsFlipped  = 0;
+}
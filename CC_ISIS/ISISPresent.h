@@ -0,0 +1,180 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISBlit.h"
+#include "ISISDamage.h"
+#include "ISISPerf.h"
+
+// The palette is looked up by the double-buffered flip.
+#if defined(ISIS_PALETTE) && !defined(ISIS_DOUBLE_BUFFER)
+#error "ISIS_PALETTE is shown by the double-buffered flip; build it with ISIS_DOUBLE_BUFFER"
+#endif
+
+// The core the frames are drawn on: the Arduino loop's, or with -DISIS_RENDER_TASK the render task's
+// (CC_ISIS.cpp). The presenter's uploads run on the other one.
+#ifdef ISIS_RENDER_TASK
+#define ISIS_RENDER_CORE 0
+#else
+#define ISIS_RENDER_CORE 1
+#endif
+
+// Tear-free presentation on the RGB panel.
+//
+// Bus_RGB scans the panel out of a PSRAM framebuffer continuously. A sprite
+// pushed straight into it lands while the beam is somewhere down the screen,
+// so the speed tape, attitude and altitude of one frame can show with parts of
+// the last one above or below the beam line.
+//
+// Double buffered (-DISIS_DOUBLE_BUFFER), the frame is composed in a second 480x480 PSRAM buffer
+// (target()) and flip() waits for the panel's vsync, then copies the damaged
+// rectangles into the scanned buffer in the order the panel scans its lines,
+// starting in the vertical blanking and keeping ahead of the beam. LovyanGFX owns the scanned buffer and
+// has no way to swap it for another, so the flip is this copy rather than a
+// pointer swap.
+//
+// Single buffered, target() is the panel itself and flip() only counts. That
+// is the default until double buffering has been checked on both boards, and
+// the mode double buffered falls back to when the back buffer can't be
+// allocated or vsync stops arriving.
+//
+// Double buffered, a palette (ISISPalette.h) can stand between the two: the
+// flip then looks each 8-bit pixel up in it rather than copying it as RGB332.
+//
+// Either way the vsync interrupt also times the panel's refresh against what
+// the bus config asks for (panelCounts()): how far the frames drift from it,
+// and how many intervals were off by more than a couple of lines.
+//
+// Double buffered, the sprites' uploads into the back buffer are plain row
+// copies (both are Pixels, ISISBlit.h) and are queued to a task on the other core, so the
+// next sprite is rendered while the last one is copied. fence() waits for a
+// sprite's uploads before it is drawn in again; flip() waits for all of them.
+class FramePresenter
+{
+public:
+    // vsyncPin: the bus's pin_vsync, watched as an input alongside the LCD peripheral driving it.
+    // vsyncIdleHigh: the bus's vsync_polarity; the wait is for the edge out of idle.
+    void begin(LovyanGFX *panel, int vsyncPin, bool vsyncIdleHigh, bool doubleBuffered);
+    // Undo begin(): end the upload task once its queue is done, stop watching vsync and free the back
+    // buffer, so begin() can start again.
+    void end();
+    // The frame period and line time the bus config asks for.
+    void setTiming(uint32_t framePeriodUs, uint32_t lineUs);
+    // The refreshes each frame is paced to stay on the panel for (FrameScheduler's period); 1 unpaced.
+    void setFrameRefreshes(uint32_t refreshes) { _frameRefreshes = refreshes ? refreshes : 1; }
+
+    bool       doubleBuffered() const { return _back.getBuffer() != nullptr; }
+    LovyanGFX *target() { return doubleBuffered() ? (LovyanGFX *)&_back : _panel; }
+
+    // (x, y, w, h) of the back buffer, to draw part of the frame in place rather than in a sprite that
+    // is then uploaded. No pixels when single buffered.
+    PixelSurface surface(int32_t x, int32_t y, int32_t w, int32_t h);
+
+    // (x, y, w, h) of target() changed this frame and has to reach the panel.
+    void damage(int32_t x, int32_t y, int32_t w, int32_t h) { _damage.add(x, y, w, h); }
+    // Everything, e.g. after the panel was cleared.
+    void damageAll() { _damage.addAll(); }
+
+    // Put the r part of sprite at (x + r.x, y + r.y) of target() and damage it there. Double buffered, with
+    // asyncUploads, the copy is queued and this returns at once.
+    void upload(LGFX_Sprite &sprite, int32_t x, int32_t y, const DamageRect &r);
+    // Wait until sprite's queued uploads are done, before drawing in it.
+    void fence(const LGFX_Sprite &sprite);
+
+    // Present the frame: wait for the uploads and vsync, and copy the damage to the panel.
+    void flip();
+
+    // Show the back buffer through palette (256 colours, one per 8-bit pixel value) from the next flip,
+    // which sends all of it; nullptr shows the pixels as RGB332. The table is read at every flip, so it
+    // must outlive its use. Ignored with 16-bit pixels.
+    void                  setPalette(const lgfx::bgr888_t *palette);
+    const lgfx::bgr888_t *palette() const { return _palette; }
+
+    bool asyncUploads = true; // false: upload() copies before it returns
+
+    PerfSample    latency;            // us from flip() to the frame being on the panel
+    PerfSample    copyTime;           // us of that spent copying
+    unsigned long flips          = 0;
+    unsigned long missedVsyncs   = 0; // refreshes a frame stayed up past its pace, the next being too slow
+    unsigned long lateCopies     = 0; // copies still going at the next vsync: may have torn
+    unsigned long timeouts       = 0; // waits for vsync given up
+    PerfSample    uploadTime;         // us per frame the other core spent on uploads
+    PerfSample    uploadWait;         // us per frame this one waited for them; uploadTime less this is the overlap
+    unsigned long pixelsUploaded = 0; // into target()
+    unsigned long pixelsFlipped  = 0; // copied from the back buffer to the panel
+
+    void resetStats();
+
+    // Totals since boot, not reset with the stats above; the difference of two measures a stretch.
+    struct PanelCounts {
+        uint32_t intervals; // vsync intervals timed
+        uint32_t underruns; // of those, off the frame period by more than two lines: the LCD stalled or
+                            // restarted. Taken for DMA starved of PSRAM, which is not yet checked on a panel
+        int32_t  driftUs;   // measured less asked-for period, summed
+        uint32_t late;      // lateCopies
+        uint32_t timeouts;
+    };
+    PanelCounts panelCounts() const;
+    uint32_t    framePeriodUs() const { return _periodUs; }
+    // How much longer than asked for the refreshes between two counts took, in parts per million.
+    int32_t driftPpm(const PanelCounts &from, const PanelCounts &to) const;
+
+private:
+    static const uint32_t VSYNC_TIMEOUT_MS = 100; // the panel refreshes at 30..60 Hz
+    static const int      MAX_TIMEOUTS     = 3;   // in a row, before giving up on vsync
+    static const int32_t  SCAN_STRIP       = 48;  // panel lines copied at a time, in scan order
+
+    static const int UPLOAD_QUEUE = 16; // uploads in flight; upload() waits for a free slot past this
+    static const int FENCES       = 8;  // sprites with uploads in flight
+
+    struct Upload {
+        const Pixel *src;
+        Pixel       *dst;
+        int32_t      srcStride, dstStride;
+        int16_t      w, h;
+    };
+
+    static void IRAM_ATTR onVsync(void *arg);
+    bool                  watchVsync();
+    void                  unwatchVsync();
+    static void           uploadTask(void *arg);
+    bool                  startUploads();
+    void                  waitUploads(uint32_t seq);
+    void                  fallBack();
+    void                  pushBack();
+
+    LovyanGFX            *_panel = nullptr;
+    LGFX_Sprite           _back;
+    const lgfx::bgr888_t *_palette = nullptr;
+    Damage                _damage;
+    int                   _vsyncPin       = -1;
+    bool                  _idleHigh       = false;
+    volatile uint32_t     _vsyncs         = 0;
+    volatile TaskHandle_t _waiter         = nullptr;
+    uint32_t              _lastVsyncs     = 0; // _vsyncs at the last flip
+    uint32_t              _frameRefreshes = 1; // setFrameRefreshes()
+    int                   _timeoutRun     = 0;
+
+    // Panel timing, for PanelCounts.
+    uint32_t          _periodUs      = 0;
+    uint32_t          _toleranceUs   = 0;
+    volatile uint32_t _lastVsyncUs   = 0;
+    volatile uint32_t _intervals     = 0;
+    volatile uint32_t _underruns     = 0;
+    volatile int32_t  _driftUs       = 0;
+    uint32_t          _totalLate     = 0;
+    uint32_t          _totalTimeouts = 0;
+
+    QueueHandle_t         _uploads      = nullptr;
+    volatile TaskHandle_t _uploader     = nullptr; // cleared by the task as it ends
+    volatile TaskHandle_t _uploadWaiter = nullptr;
+    uint32_t              _uploadsSent  = 0;
+    volatile uint32_t     _uploadsDone  = 0;
+    volatile uint32_t     _uploadUs     = 0; // this frame, on the other core
+    uint32_t              _waitUs       = 0; // this frame, here
+    struct {
+        const LGFX_Sprite *sprite;
+        uint32_t           seq; // its last upload
+    } _fences[FENCES] = {};
+};
+
+extern FramePresenter framePresenter;
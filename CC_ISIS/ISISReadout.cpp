@@ -0,0 +1,43 @@
+#include "ISISReadout.h"
+#include "ISISBlit.h"
+
+bool Readout::begin(int16_t width, int16_t height)
+{
+    _sprite.setColorDepth(ISIS_COLOR_DEPTH);
+    invalidate();
+    return _sprite.createSprite(width, height) != nullptr;
+}
+
+void Readout::setTarget(LovyanGFX *target, int32_t x, int32_t y, bool retained)
+{
+    if (target != _target || x != _x || y != _y) _shown = false;
+    _target   = target;
+    _x        = x;
+    _y        = y;
+    _retained = retained;
+}
+
+bool Readout::update(const char *text)
+{
+    if (_drawn && strncmp(text, _text, MAX_TEXT) == 0) return false;
+
+    strncpy(_text, text, MAX_TEXT);
+    _text[MAX_TEXT] = 0;
+    _drawn          = true;
+    _shown          = false;
+    renders++;
+    return true;
+}
+
+bool Readout::push()
+{
+    if (!_target) return false;
+    if (_retained && _shown) {
+        skips++;
+        return false;
+    }
+    _sprite.pushSprite(_target, _x, _y);
+    _shown = true;
+    pushes++;
+    return true;
+}
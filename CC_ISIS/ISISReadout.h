@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ISISCommon.h"
+
+// A small readout that keeps its own sprite and remembers what it shows.
+//
+// The text a readout displays stands for everything its picture depends on
+// (the value and how it is formatted). update() says whether that text
+// changed since the sprite was drawn; only then does the caller draw it again.
+// push() puts the sprite on its target, unless the target is retained (the
+// panel) and already shows it.
+//
+//   if (readout.update(text)) { ... draw text into readout.sprite() ... }
+//   readout.push();
+class Readout
+{
+public:
+    static const int MAX_TEXT = 15;
+
+    bool begin(int16_t width, int16_t height);
+    bool valid() const { return _sprite.getBuffer() != nullptr; }
+    LGFX_Sprite &sprite() { return _sprite; }
+
+    // retained: target keeps what was pushed until the next push. Otherwise
+    // (a sprite that is redrawn each frame) the readout is pushed every time.
+    void setTarget(LovyanGFX *target, int32_t x, int32_t y, bool retained);
+
+    // True when text differs from what the sprite holds: draw it now. Texts past MAX_TEXT characters compare
+    // only that far.
+    bool update(const char *text);
+    // Return whether it pushed.
+    bool push();
+
+    // Something else drew over the sprite or the target: the next update() and push() do both again.
+    void invalidate() { _drawn = _shown = false; }
+
+    unsigned long renders = 0;
+    unsigned long pushes  = 0;
+    unsigned long skips   = 0; // pushes left out because the target already showed the sprite
+
+private:
+    LGFX_Sprite _sprite;
+    LovyanGFX  *_target   = nullptr;
+    int32_t     _x        = 0;
+    int32_t     _y        = 0;
+    bool        _retained = false;
+    bool        _drawn    = false; // the sprite holds _text
+    bool        _shown    = false; // and the target holds the sprite
+    char        _text[MAX_TEXT + 1];
+};
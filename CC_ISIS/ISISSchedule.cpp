@@ -0,0 +1,78 @@
+#include "ISISSchedule.h"
+
+void FrameScheduler::begin(const Layer *layers, int count)
+{
+    _layers = layers;
+    _count  = count < MAX_LAYERS ? count : MAX_LAYERS;
+}
+
+void FrameScheduler::setPeriod(uint32_t periodUs)
+{
+    _periodUs = periodUs;
+    _slotUs   = micros();
+}
+
+uint32_t FrameScheduler::untilDue() const
+{
+    if (!_periodUs) return 0;
+    const int32_t left = (int32_t)(_slotUs - micros());
+    return left > 0 ? left : 0;
+}
+
+bool FrameScheduler::wait() const
+{
+    // Whole ticks asleep, which never overshoot (vTaskDelay(n) wakes at the n-th tick from now), then
+    // the rest spinning: the frame starts on the microsecond, not on the next tick.
+    const uint32_t tickUs = portTICK_PERIOD_MS * 1000;
+    const uint32_t left   = untilDue();
+    const bool     sleeps = left >= tickUs;
+    if (sleeps) vTaskDelay(left / tickUs);
+    while (untilDue()) {}
+    return sleeps;
+}
+
+void FrameScheduler::startFrame()
+{
+    const uint32_t now = micros();
+    _startUs           = now;
+    if (!_periodUs) return;
+
+    const int32_t behind = (int32_t)(now - _slotUs);
+    if (behind < 0) { // started early: the slot is still this frame's
+        _slotUs += _periodUs;
+        return;
+    }
+    late.add(behind);
+    const uint32_t missed = behind / _periodUs;
+    dropped += missed;
+    _slotUs += (missed + 1) * _periodUs;
+}
+
+void FrameScheduler::endFrame()
+{
+    const uint32_t now = micros();
+    frameTime.add(now - _startUs);
+    if (_endUs) {
+        const uint32_t us = now - _endUs;
+        interval.add(us);
+        if (_periodUs) jitter.add(us > _periodUs ? us - _periodUs : _periodUs - us);
+    }
+    _endUs = now ? now : 1;
+
+    for (int i = 0; i < _count; i++)
+        if (due(i)) layerFrames[i]++;
+    frames++;
+    _frame++;
+    _all = false;
+}
+
+void FrameScheduler::resetStats()
+{
+    frames  = 0;
+    dropped = 0;
+    late    = PerfSample();
+    jitter  = PerfSample();
+    frameTime.reset();
+    interval.reset();
+    for (int i = 0; i < MAX_LAYERS; i++) layerFrames[i] = 0;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "ISISCommon.h"
+#include "ISISPerf.h"
+
+// Paces the frames to a fixed rate and decides which layers each one draws.
+//
+// A frame starts in a slot every periodUs(), not as soon as the last one is
+// done, so the panel shows a new frame at a steady cadence however long each
+// took to draw. A frame that runs past the next slot starts the one after it
+// late; slots it ran past entirely are dropped rather than made up with frames
+// back to back.
+//
+// Each layer is drawn every period frames, in those where the frame number
+// modulo period is phase. Layers that change slowly get a longer period, and
+// different phases keep two of them from landing in the same frame. drawAll()
+// draws every layer in the frame, for when the panel has to be sent whole.
+class FrameScheduler
+{
+public:
+    struct Layer {
+        const char *name;
+        uint16_t    period; // frames
+        uint16_t    phase;  // below period
+    };
+    static const int MAX_LAYERS = 8;
+
+    // layers must outlive the scheduler; at most MAX_LAYERS.
+    void begin(const Layer *layers, int count);
+    int          layerCount() const { return _count; }
+    const Layer &layer(int i) const { return _layers[i]; }
+
+    // A frame every periodUs from now; 0 starts one whenever asked.
+    void     setPeriod(uint32_t periodUs);
+    uint32_t periodUs() const { return _periodUs; }
+
+    // Microseconds until the next slot, 0 once it has come: for a caller that has other things to do.
+    uint32_t untilDue() const;
+    // Sleep until the next slot: for a task that only draws frames. Returns whether it slept at all,
+    // false when the slot had come or was less than a tick away.
+    bool wait() const;
+
+    // The frame starts, in the slot that has come.
+    void startFrame();
+    // Whether this frame draws layer i.
+    bool due(int i) const { return _all || _frame % _layers[i].period == _layers[i].phase; }
+    // This frame draws every layer.
+    void drawAll() { _all = true; }
+    // The frame is on the panel.
+    void endFrame();
+
+    unsigned long frames  = 0;
+    unsigned long dropped = 0; // slots passed with no frame started in them
+    PerfSample    late;        // us a frame started after its slot
+    PerfSample    jitter;      // us the time between two frames was off periodUs()
+    PerfHistogram frameTime;   // us from startFrame() to endFrame()
+    PerfHistogram interval;    // us from one endFrame() to the next
+
+    unsigned long layerFrames[MAX_LAYERS] = {}; // frames each layer was drawn in
+
+    void resetStats();
+
+private:
+    const Layer *_layers   = nullptr;
+    int          _count    = 0;
+    uint32_t     _periodUs = 0;
+    uint32_t     _slotUs   = 0; // micros() of the next slot
+    uint32_t     _startUs  = 0; // of this frame
+    uint32_t     _endUs    = 0; // of the last one; 0 before the first
+    uint32_t     _frame    = 0; // frames drawn, for the layers' phases
+    bool         _all      = false;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+// A value one task publishes and others read whole, without locks.
+//
+// The writer bumps a sequence number to odd, copies the value in, and bumps
+// it to even. A reader copies the value out between two reads of the
+// sequence and starts again if they differ or were odd, so it never keeps a
+// copy the writer was part way through: pitch from one message with bank
+// from the one before. Neither side waits on the other: the writer never, a
+// reader only for as long as one copy takes, when it lands on one.
+//
+// One writer only. T must be trivially copyable.
+//
+// Plain C++ with no Arduino / LovyanGFX dependency; host/ builds it on a
+// desktop and checks it from two threads.
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+template <typename T>
+class Seqlock
+{
+public:
+    void publish(const T &value)
+    {
+        const uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&_value, &value, sizeof(T));
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // The last value published. Returns how many times the copy had to start again.
+    uint32_t read(T &out) const
+    {
+        for (uint32_t retries = 0;; retries++) {
+            const uint32_t before = _seq.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            memcpy(&out, &_value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_seq.load(std::memory_order_relaxed) == before) return retries;
+        }
+    }
+
+    // Publishes so far, to tell whether there is anything new without copying it.
+    uint32_t version() const { return _seq.load(std::memory_order_acquire) / 2; }
+
+private:
+    std::atomic<uint32_t> _seq{ 0 };
+    T                     _value;
+};
@@ -0,0 +1,454 @@
+#pragma once
+
+#include "ISISAtlasFont.h"
+
+// A320ISIS24 from isisFont.h, 19979 bytes, cut down to
+//   1.0: "-.0123456789DEGNST"
+//   1.2: "0123456789DST"
+// 6802 bytes. Written by Scripts/VlwToHeader.py --atlas; edit that, not this.
+
+const uint8_t A320ISIS24_bitmap[] PROGMEM = {
+    0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x03,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20, 0x6B, 0xCB, 0x5E, 0xFF, 0xFC, 0xEF, 0xFF, 0xCE, 0xFF,
+    0xFC, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
+    0xFD, 0x30, 0x00, 0x00, 0x1D, 0xFF, 0xB9, 0xBE, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x30, 0x00, 0x1B,
+    0xFE, 0x10, 0x04, 0xFF, 0x30, 0x00, 0x00, 0x1D, 0xF7, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x6F,
+    0xD0, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x0E, 0xF4,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x51, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x1F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x51, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x1F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x51, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x1F, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x51, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x40, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x0B, 0xF7, 0x00, 0x00, 0x00,
+    0x04, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x5F,
+    0xF4, 0x00, 0x05, 0xFF, 0xB5, 0x24, 0x9F, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x03, 0x9D, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0xAF, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x6F, 0xF5, 0xFF, 0x10, 0x00, 0x00, 0x3F,
+    0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x0D, 0xFB, 0x01, 0xFF, 0x10, 0x00, 0x00, 0xED, 0x10, 0x1F, 0xF1,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00,
+    0x01, 0x22, 0x23, 0xFF, 0x42, 0x22, 0x10, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x02, 0x68, 0x87, 0x41, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF,
+    0xFF, 0xFE, 0x81, 0x00, 0x00, 0x3E, 0xFF, 0xCA, 0x9A, 0xDF, 0xFC, 0x10, 0x01, 0xDF, 0xD3, 0x00,
+    0x00, 0x05, 0xEF, 0xA0, 0x08, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xF2, 0x0E, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xF6, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x01, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+    0xE5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x20, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x37, 0x87, 0x40, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFE,
+    0x60, 0x00, 0x06, 0xFF, 0xFB, 0x9A, 0xEF, 0xF9, 0x00, 0x0D, 0xFA, 0x10, 0x00, 0x07, 0xFF, 0x50,
+    0x04, 0x60, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x5C, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xEF, 0xFF, 0xE5,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x02, 0x57, 0xCF, 0xFD, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xF9,
+    0xEF, 0xB1, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0x4F, 0xFE, 0x84, 0x24, 0x6C, 0xFF, 0x80, 0x04, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x16, 0xBD, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0xF8, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD1, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x50, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF3,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x10,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x9F, 0xD0, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x0C, 0xFF, 0xBB, 0xBB,
+    0xBB, 0xFF, 0xCB, 0xB3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x03, 0x66, 0x66, 0x66,
+    0x66, 0xEF, 0x86, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x10, 0x00, 0x04, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x87, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x99, 0x99, 0x99,
+    0x99, 0x98, 0x11, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x44, 0x33, 0x10, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x09, 0xEE, 0xEE, 0xEF, 0xFF, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x8E, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xF4, 0x07, 0x70, 0x00, 0x00, 0x00, 0x4E, 0xFB, 0x01, 0xFF, 0xD7, 0x43, 0x36, 0xBF, 0xFC,
+    0x10, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x01, 0x6B, 0xDF, 0xEC, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x68, 0x87, 0x40, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xFE, 0x70, 0x00,
+    0x00, 0x6F, 0xFF, 0xC9, 0x9B, 0xEF, 0xFC, 0x10, 0x03, 0xFF, 0xA2, 0x00, 0x00, 0x16, 0xEF, 0x60,
+    0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x34, 0x54, 0x10, 0x00, 0x00,
+    0x1F, 0xF1, 0x8E, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x1F, 0xFD, 0xFF, 0xFD, 0xCE, 0xFF, 0xF6, 0x00,
+    0x1F, 0xFF, 0xE5, 0x10, 0x00, 0x3A, 0xFF, 0x40, 0x1F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0xAF, 0xC0,
+    0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7,
+    0x0E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF1,
+    0x04, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xDF, 0xA0, 0x00, 0x9F, 0xFB, 0x63, 0x34, 0x8E, 0xFD, 0x20,
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x29, 0xCE, 0xFD, 0xA5, 0x00, 0x00,
+    0x06, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x06, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x9F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x57, 0x86, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFC, 0x20, 0x00,
+    0x00, 0x0B, 0xFF, 0xDA, 0x9B, 0xFF, 0xE3, 0x00, 0x00, 0x8F, 0xF5, 0x00, 0x00, 0x2C, 0xFE, 0x10,
+    0x01, 0xEF, 0x60, 0x00, 0x00, 0x01, 0xEF, 0x60, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x90,
+    0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0x02, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xAF, 0x90,
+    0x00, 0xCF, 0xB0, 0x00, 0x00, 0x05, 0xFF, 0x30, 0x00, 0x3F, 0xFC, 0x50, 0x02, 0x9F, 0xF9, 0x00,
+    0x00, 0x04, 0xEF, 0xFE, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x4E, 0xFE, 0x95, 0x57, 0xDF, 0xF9, 0x00, 0x01, 0xEF, 0xC2, 0x00, 0x00, 0x07, 0xFF, 0x60,
+    0x08, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF4,
+    0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF6, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8,
+    0x0F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF3,
+    0x05, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xCF, 0xC0, 0x00, 0xAF, 0xFC, 0x63, 0x35, 0x8E, 0xFE, 0x20,
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x28, 0xCE, 0xFD, 0xA5, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x68, 0x87, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFD, 0x60, 0x00,
+    0x00, 0x4E, 0xFF, 0xC9, 0x9B, 0xEF, 0xF9, 0x00, 0x01, 0xEF, 0xC3, 0x00, 0x00, 0x18, 0xFF, 0x60,
+    0x08, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF4,
+    0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8,
+    0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x04, 0xEF, 0xF8,
+    0x00, 0x6F, 0xFE, 0x96, 0x67, 0xBF, 0xFF, 0xF8, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xAA, 0xF8,
+    0x00, 0x00, 0x16, 0x9B, 0xBA, 0x72, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF4,
+    0x00, 0xEE, 0x40, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0xCF, 0xFB, 0x64, 0x34, 0x7D, 0xFF, 0x40,
+    0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x39, 0xDE, 0xFE, 0xB6, 0x10, 0x00,
+    0x06, 0x88, 0x88, 0x88, 0x86, 0x20, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x00,
+    0x1F, 0xF9, 0x99, 0x99, 0x9C, 0xFF, 0xE3, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x3D, 0xFD, 0x00,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x70, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF4,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA0,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x30, 0x1F, 0xF3, 0x22, 0x22, 0x36, 0xBF, 0xF7, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xED, 0x82, 0x00, 0x00,
+    0x06, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x1F, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x51, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xDD,
+    0xDD, 0xDD, 0xDC, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF,
+    0x54, 0x44, 0x44, 0x44, 0x10, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD0, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x15, 0x78,
+    0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x01, 0xCF, 0xFD, 0xA9,
+    0xCF, 0xFF, 0x90, 0x00, 0x09, 0xFE, 0x50, 0x00, 0x02, 0xAF, 0xFC, 0x10, 0x2F, 0xF4, 0x00, 0x00,
+    0x00, 0x05, 0xEF, 0xC1, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFA, 0xCF, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xE9, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 0x00, 0x14, 0x44, 0x44, 0x44, 0x41, 0xFF, 0x20, 0x00, 0x9F,
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x20, 0x00, 0x6D, 0xDD, 0xDD, 0xDE, 0xFC, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xFC, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0xBF, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xF5, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x1E, 0xF8, 0x00, 0x00,
+    0x00, 0x19, 0xFF, 0x40, 0x06, 0xFF, 0xB5, 0x33, 0x48, 0xDF, 0xF7, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x50, 0x00, 0x00, 0x03, 0x9D, 0xFE, 0xDB, 0x61, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x73, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x1F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0x1F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x1F, 0xFF, 0xE1, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0x1F, 0xFD, 0xF9, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x1F, 0xF5, 0xFF, 0x30,
+    0x00, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0xAF, 0xC0, 0x00, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x2F, 0xF6,
+    0x00, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x08, 0xFE, 0x10, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0xDF,
+    0x90, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x5F, 0xF3, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x0B,
+    0xFC, 0x00, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x02, 0xFF, 0x60, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x00,
+    0x8F, 0xE1, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x00, 0x1D, 0xF8, 0x05, 0xFC, 0x1F, 0xF1, 0x00, 0x00,
+    0x05, 0xFF, 0x35, 0xFC, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0xBF, 0xB5, 0xFC, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x2F, 0xFA, 0xFC, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x01, 0xDF, 0xFC, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xFC, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x03, 0x67,
+    0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+    0xCA, 0xAE, 0xFF, 0xD3, 0x00, 0x00, 0x7F, 0xF9, 0x20, 0x00, 0x05, 0xDF, 0xE3, 0x00, 0x2F, 0xF6,
+    0x00, 0x00, 0x00, 0x01, 0xCF, 0xE2, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xD0, 0x9F,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x48, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81,
+    0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xC5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xED, 0xC9, 0x50,
+    0x00, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x59,
+    0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x70, 0x4C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x08, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xB0, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0xEF, 0x80,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x05, 0xEF, 0xA0, 0x00, 0x0A,
+    0xFF, 0xC7, 0x56, 0x8C, 0xFF, 0xC1, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x7A, 0xCB, 0xA6, 0x10, 0x00, 0x00, 0x05, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x70, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0x99, 0x99, 0x99, 0xFF, 0xA9,
+    0x99, 0x99, 0x70, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x87, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBB, 0xFF, 0xFF, 0xFF, 0xD3,
+    0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFB, 0x9B, 0xEE, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xDD, 0x30, 0x00,
+    0x11, 0xBF, 0xE1, 0x00, 0x04, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x1D, 0xF7, 0x00, 0x04, 0xFF, 0x33,
+    0x00, 0x00, 0x00, 0x1D, 0xF7, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x0D,
+    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x11, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0x44, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55,
+    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xCF, 0x55, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x55, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDF, 0x44, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x33, 0x0B, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x07,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x01, 0xEF, 0x99, 0x00, 0x00, 0x00, 0x5F, 0xF4,
+    0x00, 0x00, 0x5F, 0xFF, 0xB5, 0x24, 0x99, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x33, 0x9D, 0xFE, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2E, 0xFF, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0xCC, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xEF, 0xF1, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0xFF, 0x10, 0x00, 0x00,
+    0x03, 0xFF, 0x88, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x0E,
+    0xD1, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x01, 0x22, 0x22, 0x3F, 0xF4, 0x22, 0x22, 0x10, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00,
+    0x00, 0x26, 0x88, 0x77, 0x41, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10,
+    0x00, 0x00, 0x3E, 0xFF, 0xFC, 0xA9, 0xAA, 0xDF, 0xFC, 0x11, 0x00, 0x1D, 0xFD, 0xD3, 0x00, 0x00,
+    0x00, 0x5E, 0xFA, 0xA0, 0x08, 0xFD, 0x11, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x20, 0x8F, 0xD1,
+    0x10, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF2, 0x0E, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0x60, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xCF, 0xE1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xBF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xF7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF9, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x32, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x20, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x03, 0x78, 0x74, 0x40, 0x00, 0x00,
+    0x00, 0x04, 0xDD, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xB9, 0xAE, 0xEF, 0xF9,
+    0x00, 0x00, 0xDF, 0xAA, 0x10, 0x00, 0x00, 0x7F, 0xF5, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xC0, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0x5C, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xCF, 0xF3, 0x00, 0x00, 0x00,
+    0x00, 0xAE, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x25, 0x7C, 0xCF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xCC, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x9D, 0xD1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0x99, 0xEF, 0xB1, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0x34, 0xFF, 0xEE, 0x84,
+    0x24, 0x66, 0xCF, 0xF8, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x01, 0x66,
+    0xBD, 0xFE, 0xCC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF8, 0x8D, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x11, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x50, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFC, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x30, 0x00, 0xDF, 0x40,
+    0x00, 0x00, 0x00, 0x0D, 0xDF, 0x90, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE1, 0x00,
+    0x00, 0xDF, 0x40, 0x00, 0x00, 0x01, 0xEF, 0xF7, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x9F,
+    0xDD, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x09, 0xFD, 0xD0, 0x00, 0x00, 0x0D, 0xF4, 0x00,
+    0x00, 0x03, 0xFF, 0x44, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0xCF, 0xFB, 0xBB, 0xBB, 0xBB,
+    0xBF, 0xFC, 0xBB, 0xB3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x36, 0x66,
+    0x66, 0x66, 0x66, 0x6E, 0xF8, 0x65, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xD1, 0x00, 0x00,
+    0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0x1F, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x11, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xF4, 0x44, 0x43, 0x31, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC,
+    0x60, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x60, 0x00, 0x00, 0x09, 0xEE, 0xEE, 0xEE,
+    0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0xEF, 0xE3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x44, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFB,
+    0x00, 0x1F, 0xFD, 0x77, 0x43, 0x36, 0xBB, 0xFF, 0xC1, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x10, 0x00, 0x00, 0x16, 0xBB, 0xDF, 0xEC, 0x88, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+    0x88, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xCF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00,
+    0x6F, 0xFF, 0xFC, 0x99, 0xBB, 0xEF, 0xFC, 0x11, 0x00, 0x3F, 0xFA, 0xA2, 0x00, 0x00, 0x01, 0x6E,
+    0xF6, 0x60, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x11, 0x00, 0xAF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x81, 0x10, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x03, 0x45,
+    0x44, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x34, 0x54, 0x41, 0x00, 0x00, 0x00, 0x1F, 0xF1,
+    0x88, 0xEF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x01, 0xFF, 0xDF, 0xFF, 0xFD, 0xCE, 0xEF, 0xFF, 0x60,
+    0x00, 0x1F, 0xFF, 0xEE, 0x51, 0x00, 0x00, 0x3A, 0xFF, 0x44, 0x01, 0xFF, 0xE2, 0x20, 0x00, 0x00,
+    0x00, 0x0A, 0xFC, 0xC0, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x31, 0xFF, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+    0x61, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0x70, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x0A, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x10, 0xAF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF1,
+    0x04, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xAA, 0x00, 0x09, 0xFF, 0xFB, 0x63, 0x34, 0x48,
+    0xEF, 0xD2, 0x20, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x02, 0x29,
+    0xCE, 0xFD, 0xDA, 0x50, 0x00, 0x00, 0x06, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x06, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9D, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xF6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xFE, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE1, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1E, 0xF9, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xEF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xDD, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x78, 0x66, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8E, 0xFF, 0xFF, 0xFF,
+    0xC2, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0xA9, 0xBB, 0xFF, 0xE3, 0x00, 0x00, 0x08, 0xFF, 0xF5,
+    0x00, 0x00, 0x02, 0xCF, 0xE1, 0x10, 0x01, 0xEF, 0x66, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x66, 0x00,
+    0x1E, 0xF6, 0x60, 0x00, 0x00, 0x00, 0x1E, 0xF6, 0x60, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x99, 0x00, 0x4F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFB, 0xB0, 0x02, 0xFF, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0x99, 0x00, 0x0C, 0xFB, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x30, 0x00,
+    0x3F, 0xFF, 0xC5, 0x00, 0x22, 0x9F, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x50, 0x02, 0x29, 0xFF,
+    0x90, 0x00, 0x00, 0x04, 0xEE, 0xFF, 0xED, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x3D, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xE9, 0x55, 0x77, 0xDF, 0xF9, 0x00, 0x00, 0x1E,
+    0xFC, 0xC2, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0x60, 0x08, 0xFD, 0x11, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xEE, 0x00, 0x8F, 0xD1, 0x10, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xE0, 0x0D, 0xF6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0x40, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF6, 0x1F, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x80, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xF6, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0xBF, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xF3, 0x05, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xCC, 0x00, 0x0A, 0xFF,
+    0xFC, 0x63, 0x35, 0x58, 0xEF, 0xE2, 0x20, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+    0x00, 0x00, 0x02, 0x28, 0xCE, 0xFD, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x88, 0x77,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xBF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x4E, 0xFF,
+    0xFC, 0x99, 0xBB, 0xEF, 0xF9, 0x00, 0x00, 0x1E, 0xFC, 0xC3, 0x00, 0x00, 0x01, 0x8F, 0xF6, 0x60,
+    0x08, 0xFD, 0x11, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEE, 0x00, 0x8F, 0xD1, 0x10, 0x00, 0x00, 0x00,
+    0x07, 0xFE, 0xE0, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x40, 0xFF, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0xFF, 0x80, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF8, 0x09, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x2F, 0xF9, 0x90, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xF8, 0x00,
+    0x6F, 0xFF, 0xE9, 0x66, 0x77, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x5E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA,
+    0xAF, 0xF8, 0x00, 0x00, 0x11, 0x69, 0xBB, 0xAA, 0x72, 0x09, 0xFF, 0x80, 0x00, 0x01, 0x16, 0x9B,
+    0xBA, 0xA7, 0x20, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1E, 0xFF, 0x40, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF4, 0x00, 0xEE,
+    0x44, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xDD, 0x00, 0x0C, 0xFF, 0xFB, 0x64, 0x34, 0x47, 0xDF, 0xF4,
+    0x40, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03, 0x39, 0xDE, 0xFE,
+    0xEB, 0x61, 0x00, 0x00, 0x06, 0x88, 0x88, 0x88, 0x88, 0x66, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x1F, 0xF9, 0x99, 0x99, 0x99, 0xCC, 0xFF, 0xE3, 0x00,
+    0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xD0, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xEF, 0x77, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF7, 0x70, 0x1F, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0xDD, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF2,
+    0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x51, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAF, 0xF7, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x81, 0xFF, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x81,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xFF, 0x81, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x1F, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0x81, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x1F,
+    0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x71, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xF6, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x41, 0xFF, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xFF, 0xF1, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0x01, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xA0, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x33, 0x01, 0xFF, 0x32, 0x22, 0x22, 0x36, 0x6B, 0xFF, 0x70, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xED, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x77, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDD, 0xFF, 0xFF, 0xFF, 0xE8, 0x10,
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFC, 0xAA, 0xEE, 0xFF, 0xD3, 0x00, 0x00, 0x07, 0xFF, 0x99, 0x20,
+    0x00, 0x00, 0x5D, 0xFE, 0x33, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xEE, 0x20,
+    0x2F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xEE, 0x20, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0xFF, 0xD0, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEE, 0xF4, 0x8F, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x81, 0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xCC, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5E, 0xFF, 0xFF, 0xED, 0xCC, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0xDF, 0xFF, 0xFF,
+    0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x55, 0x9E, 0xFF, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF,
+    0xEE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x70, 0x4C, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x8F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0,
+    0x5F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x90, 0x0E, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x40, 0x0E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x06, 0xFF,
+    0x66, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xAA, 0x00, 0x00, 0xAF, 0xFF, 0xC7, 0x56, 0x88, 0xCF, 0xFC,
+    0x11, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A,
+    0xCB, 0xAA, 0x61, 0x00, 0x00, 0x00, 0x05, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0x99, 0x99, 0x99, 0x9F,
+    0xFF, 0xA9, 0x99, 0x99, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+    0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xD1, 0x00, 0x00, 0x00, 0x00,
+};
+
+const AtlasGlyph A320ISIS24_10_glyphs[] PROGMEM = {
+    { '-', 15, 3, 0, 16, 19, 0 },
+    { '.', 5, 5, 7, 20, 19, 23 },
+    { '0', 15, 24, 0, 1, 19, 36 },
+    { '1', 13, 24, 1, 1, 19, 216 },
+    { '2', 16, 24, 0, 1, 19, 372 },
+    { '3', 14, 24, 1, 1, 19, 564 },
+    { '4', 16, 24, 0, 1, 19, 732 },
+    { '5', 15, 24, 0, 1, 19, 924 },
+    { '6', 16, 24, 0, 1, 19, 1104 },
+    { '7', 16, 24, 0, 1, 19, 1296 },
+    { '8', 16, 24, 0, 1, 19, 1488 },
+    { '9', 16, 24, 0, 1, 19, 1680 },
+    { 'D', 16, 24, 0, 1, 19, 1872 },
+    { 'E', 17, 24, 0, 1, 19, 2064 },
+    { 'G', 16, 24, 0, 1, 19, 2268 },
+    { 'N', 16, 24, 0, 1, 19, 2460 },
+    { 'S', 17, 24, 1, 1, 19, 2652 },
+    { 'T', 18, 24, 0, 1, 19, 2856 },
+};
+const AtlasFace A320ISIS24_10 = { A320ISIS24_10_glyphs, 18, A320ISIS24_bitmap, 32 };
+
+const AtlasGlyph A320ISIS24_12_glyphs[] PROGMEM = {
+    { '0', 18, 28, 0, 1, 23, 3072 },
+    { '1', 15, 28, 1, 1, 23, 3324 },
+    { '2', 19, 28, 0, 1, 23, 3534 },
+    { '3', 17, 28, 1, 1, 23, 3800 },
+    { '4', 19, 28, 0, 1, 23, 4038 },
+    { '5', 18, 28, 0, 1, 23, 4304 },
+    { '6', 19, 28, 0, 1, 23, 4556 },
+    { '7', 19, 28, 0, 1, 23, 4822 },
+    { '8', 19, 28, 0, 1, 23, 5088 },
+    { '9', 19, 28, 0, 1, 23, 5354 },
+    { 'D', 19, 28, 0, 1, 23, 5620 },
+    { 'S', 20, 28, 1, 1, 23, 5886 },
+    { 'T', 21, 28, 0, 1, 23, 6166 },
+};
+const AtlasFace A320ISIS24_12 = { A320ISIS24_12_glyphs, 13, A320ISIS24_bitmap, 38 };
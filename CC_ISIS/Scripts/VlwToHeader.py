@@ -1,22 +1,193 @@
+import argparse
+import math
+import os
+import re
+import struct
 import sys
 
+# VLW fonts hold every glyph of the range they were made with, parsed and
+# alpha-blended at runtime. The ISIS only draws digits and a few letters, at a
+# few text sizes, so --atlas writes just those glyphs, already scaled to each
+# size, as 4-bit alpha behind a small index (see ISISAtlasFont.h).
+
+
+def read_vlw(path):
+    """The VLW bytes of a .vlw file, or of the PROGMEM array in a header written by this script or generate_font.py."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if not path.lower().endswith('.h'):
+        return data
+    text = data.decode('latin-1')
+    body = text[text.index('{') + 1:text.index('}')]
+    return bytes(int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2})', body))
+
+
+def parse_vlw(data):
+    count, _version, size, _, ascent, descent = struct.unpack_from('>6I', data, 0)
+    glyphs = []
+    offset = 24 + 28 * count
+    for i in range(count):
+        code, height, width, advance, top, left, _ = struct.unpack_from('>IIIIiiI', data, 24 + 28 * i)
+        glyphs.append({
+            'code': code, 'width': width, 'height': height, 'advance': advance,
+            'top': top, 'left': left, 'bitmap': data[offset:offset + width * height],
+        })
+        offset += width * height
+
+    # As loadFont() works them out: the font's ascent and descent, stretched by the printable glyphs.
+    max_ascent, max_descent = ascent, descent
+    for g in glyphs:
+        if 0x20 < g['code'] < 0xA0 and g['code'] != 0x7F:
+            max_ascent = max(max_ascent, g['top'])
+            max_descent = max(max_descent, g['height'] - g['top'])
+    return {'size': size, 'ascent': max_ascent, 'descent': max_descent, 'glyphs': glyphs}
+
+
+def scale_index(n, scale):
+    """For each of the scaled pixels, the source pixel covering it when source pixel i fills floor(i*s) .. floor((i+1)*s)."""
+    out = []
+    for i in range(n):
+        for _ in range(int(math.floor((i + 1) * scale)) - int(math.floor(i * scale))):
+            out.append(i)
+    return out
+
+
+def atlas_glyph(g, ascent, scale):
+    cols = scale_index(g['width'], scale)
+    rows = scale_index(g['height'], scale)
+    alpha = bytearray()
+    for r in rows:
+        for c in cols:
+            alpha.append((g['bitmap'][r * g['width'] + c] * 15 + 127) // 255)
+
+    # Trim rows and columns the scaling or the font left blank.
+    w, h = len(cols), len(rows)
+    used_x = [x for x in range(w) if any(alpha[y * w + x] for y in range(h))]
+    used_y = [y for y in range(h) if any(alpha[y * w:(y + 1) * w])]
+    if not used_x:
+        x0 = y0 = 0
+        w = h = 0
+    else:
+        x0, y0 = used_x[0], used_y[0]
+        w, h = used_x[-1] - x0 + 1, used_y[-1] - y0 + 1
+
+    packed = bytearray()
+    nibbles = [alpha[(y0 + y) * len(cols) + x0 + x] for y in range(h) for x in range(w)]
+    for i in range(0, len(nibbles), 2):
+        hi = nibbles[i]
+        lo = nibbles[i + 1] if i + 1 < len(nibbles) else 0
+        packed.append(hi << 4 | lo)
+
+    return {
+        'code': g['code'], 'w': w, 'h': h,
+        'dx': int(math.floor(g['left'] * scale)) + x0,
+        'dy': int(math.floor((ascent - g['top']) * scale)) + y0,
+        'advance': int(round(g['advance'] * scale)),
+        'bitmap': bytes(packed),
+    }
+
+
+def parse_atlas_spec(spec):
+    """'1.2:0123456789' -> (1.2, [codepoints])"""
+    size, chars = spec.split(':', 1)
+    return float(size), sorted(set(ord(c) for c in chars))
+
+
+def face_name(name, size):
+    return f'{name}_{int(round(size * 10)):02d}'
+
+
+def write_array(out, decl, data):
+    out.write(f'{decl} = {{\n')
+    for i in range(0, len(data), 16):
+        out.write('    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',\n')
+    out.write('};\n')
+
+
+def write_atlas(vlw, name, specs, out, source=None):
+    """Write the atlas header for specs [(size, [codepoints])] to out; return (vlw bytes, atlas bytes)."""
+    font = parse_vlw(vlw)
+    by_code = {g['code']: g for g in font['glyphs']}
+    if 0x20 not in by_code:  # fonts often leave out the space; the loader guesses its width
+        by_code[0x20] = {'code': 0x20, 'width': 0, 'height': 0, 'top': 0, 'left': 0, 'bitmap': b'',
+                         'advance': (font['ascent'] + font['descent']) * 2 // 7}
+
+    faces = []
+    bitmap = bytearray()
+    for size, codes in specs:
+        missing = [chr(c) for c in codes if c not in by_code]
+        if missing:
+            raise SystemExit(f'{name} has no glyph for {"".join(missing)!r}')
+        glyphs = []
+        for c in codes:
+            g = atlas_glyph(by_code[c], font['ascent'], size)
+            g['offset'] = len(bitmap)
+            bitmap += g['bitmap']
+            glyphs.append(g)
+        height = int((font['ascent'] + font['descent']) * size)
+        faces.append((size, glyphs, height))
+    if len(bitmap) > 0xFFFF:
+        raise SystemExit(f'{name}: {len(bitmap)} bytes of glyphs is more than AtlasGlyph.offset can reach')
+
+    index_bytes = sum(10 * len(g) + 16 for _, g, _ in faces)
+    atlas_bytes = index_bytes + len(bitmap)
+
+    out.write('#pragma once\n\n#include "ISISAtlasFont.h"\n\n')
+    out.write(f'// {name} from {source or "VLW"}, {len(vlw)} bytes, cut down to\n')
+    for size, glyphs, _ in faces:
+        chars = ''.join(chr(g['code']) for g in glyphs)
+        out.write(f'//   {size:.1f}: "{chars}"\n')
+    out.write(f'// {atlas_bytes} bytes. Written by Scripts/VlwToHeader.py --atlas; edit that, not this.\n\n')
+
+    write_array(out, f'const uint8_t {name}_bitmap[] PROGMEM', bitmap)
+    for size, glyphs, height in faces:
+        face = face_name(name, size)
+        out.write(f'\nconst AtlasGlyph {face}_glyphs[] PROGMEM = {{\n')
+        for g in glyphs:
+            c = chr(g['code'])
+            code = f"'{c}'" if c not in "'\\" else f"'\\{c}'"
+            out.write(f"    {{ {code}, {g['w']}, {g['h']}, {g['dx']}, {g['dy']}, {g['advance']}, {g['offset']} }},\n")
+        out.write('};\n')
+        out.write(f'const AtlasFace {face} = {{ {face}_glyphs, {len(glyphs)}, {name}_bitmap, {height} }};\n')
+
+    print(f'{name}: VLW {len(vlw)} bytes -> atlas {atlas_bytes} bytes '
+          f'({index_bytes} index + {len(bitmap)} bitmap), saves {len(vlw) - atlas_bytes}', file=sys.stderr)
+    return len(vlw), atlas_bytes
+
+
 def vlw_to_header(vlw_path, header_path, array_name):
     with open(vlw_path, 'rb') as f:
         data = f.read()
-    
+
     with open(header_path, 'w') as f:
         f.write(f'#pragma once\n\n')
         f.write(f'const uint8_t {array_name}[] PROGMEM = {{\n')
-        
+
         for i, byte in enumerate(data):
             if i % 16 == 0:
                 f.write('    ')
             f.write(f'0x{byte:02X}, ')
             if i % 16 == 15:
                 f.write('\n')
-        
+
         f.write(f'\n}};\n')
         f.write(f'const size_t {array_name}_size = {len(data)};\n')
 
+
 # Usage: python vlw_to_header.py PrimaSansBold24.vlw prima_sans_bold_24.h primaSansBold24
-vlw_to_header(sys.argv[1], sys.argv[2], sys.argv[3])
\ No newline at end of file
+#        python vlw_to_header.py Images/isisFont.h Images/isisFontAtlas.h A320ISIS24 --atlas "1.0:0123456789" --atlas "1.2:0123456789"
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('vlw', help='.vlw file, or a header holding one')
+    parser.add_argument('header')
+    parser.add_argument('name')
+    parser.add_argument('--atlas', action='append', metavar='SIZE:CHARS',
+                        help='write an atlas of CHARS at text size SIZE instead of the VLW; repeat for more sizes')
+    args = parser.parse_args()
+
+    if args.atlas:
+        with open(args.header, 'w', newline='\r\n') as f:
+            write_atlas(read_vlw(args.vlw), args.name, [parse_atlas_spec(s) for s in args.atlas], f,
+                        os.path.basename(args.vlw))
+    else:
+        vlw_to_header(args.vlw, args.header, args.name)
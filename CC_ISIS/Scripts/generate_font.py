@@ -76,6 +76,8 @@ parser.add_argument("--ascii-range", type=str, default="32-126",
 parser.add_argument("--font-size", type=int)
 parser.add_argument("--target-cap-height", type=int)
 parser.add_argument("--spacing-adjust", type=int, default=0)
+parser.add_argument("--atlas", action="append", metavar="SIZE:CHARS",
+                    help="Emit an atlas of CHARS at text size SIZE (see VlwToHeader.py) instead of the VLW; repeatable")
 args = parser.parse_args()
 
 if not args.font_size and not args.target_cap_height:
@@ -165,6 +167,13 @@ base = os.path.splitext(os.path.basename(args.ttf))[0]
 name = f"{base}{cap_height if args.target_cap_height else size}"
 macro = name.upper()
 
+if args.atlas:
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    from VlwToHeader import parse_atlas_spec, write_atlas
+
+    write_atlas(bytes(vlw), name, [parse_atlas_spec(s) for s in args.atlas], sys.stdout, os.path.basename(args.ttf))
+    sys.exit(0)
+
 print("#include <pgmspace.h>\n")
 
 print(f"#define {macro}_CAP_M_HEIGHT {cap_height}")
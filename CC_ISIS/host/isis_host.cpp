@@ -0,0 +1,310 @@
+// Host replay of the ISIS render helpers. Built by the Makefile next to this file.
+//
+// Replays a scripted flight through the raw drawing helpers the device uses
+// for the attitude and speed tape (ISISBlit.h), with the damage tracking
+// (ISISDamage.h) and the overdraw counters (ISISOverdraw.h) as the device
+// runs them, then prints the counts and writes each surface's heatmap as a
+// PPM file. Also checks Damage and hammers a Seqlock (ISISSnapshot.h) from
+// two threads. Exits non-zero when a check fails.
+//
+// Only the raw helpers run here: what CC_ISIS.cpp draws with LovyanGFX
+// (text, images, the bezel) is not replayed.
+//
+//   isis_host [frames] [output directory]
+
+#include "ISISBlit.h"
+#include "ISISDamage.h"
+#include "ISISOverdraw.h"
+#include "ISISSnapshot.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+
+// As in CC_ISIS.h / CC_ISIS.cpp.
+static const int32_t ATT_WIDTH          = 320;
+static const int32_t ATT_HEIGHT         = 350;
+static const int32_t ATT_HORIZON        = 194;
+static const int32_t SPEED_WIDTH        = 75; // ATT_LEFT_EDGE - 1
+static const float   PITCH_SCALE        = 8.0f;
+static const int32_t SPEED_TAPE_MAX     = 450;
+static const int32_t SPEED_MARK_SPACING = 19;
+static const int32_t SPEED_STRIP_MARGIN = 16;
+
+static const Pixel SKY    = pixelColor(0x001F); // TFT_BLUE
+static const Pixel GROUND = pixelColor(37316);
+static const Pixel WHITE  = pixelColor(0xFFFF);
+static const Pixel BLACK  = pixelColor(0x0000);
+static const Pixel LTGRAY = pixelColor(0xD69A); // TFT_LIGHTGRAY
+
+static int failures = 0;
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                              \
+        }                                                                            \
+    } while (0)
+
+struct Attitude {
+    float pitch;
+    float bank;
+    float airspeed;
+};
+
+// A climbing turn one way, then the other, speeding up and slowing down.
+static Attitude flight(int frame)
+{
+    const float t = frame / 60.0f;
+    Attitude    a;
+    a.pitch    = 12.0f * sinf(t * 0.7f);
+    a.bank     = 45.0f * sinf(t * 0.4f);
+    a.airspeed = 140.0f + 40.0f * sinf(t * 0.25f);
+    return a;
+}
+
+// ---- Attitude: CC_ISIS::drawHorizonFill(), drawPitchLadder() and drawHorizonLine(), whole frame ----
+
+static void drawAttitude(const PixelSurface &att, const Attitude &a)
+{
+    const float centerX = ATT_WIDTH / 2;
+    const float centerY = ATT_HORIZON - 2;
+    const float bankRad = a.bank * 3.14159265f / 180.0f;
+    const float cosBank = cosf(bankRad);
+    const float sinBank = sinf(bankRad);
+
+    OVERDRAW_STAGE("horizon");
+    fillHorizon(att, centerX, centerY - a.pitch * PITCH_SCALE / cosBank, tanf(bankRad), SKY, GROUND);
+
+    OVERDRAW_STAGE("ladder");
+    for (float deg = -90.0f; deg <= 90.0f; deg += 2.5f) {
+        if (deg == 0.0f) continue;
+        const int32_t width  = fmodf(fabsf(deg), 10.0f) == 0.0f ? 54 : fmodf(fabsf(deg), 5.0f) == 0.0f ? 27 : 17;
+        const float   offset = (deg - a.pitch) * PITCH_SCALE;
+        const float   half   = width / 2.0f;
+        drawSurfaceLine(att, (int32_t)(centerX - half * cosBank - offset * sinBank), (int32_t)(centerY - half * sinBank + offset * cosBank),
+                        (int32_t)(centerX + half * cosBank - offset * sinBank), (int32_t)(centerY + half * sinBank + offset * cosBank), WHITE);
+    }
+
+    OVERDRAW_STAGE("horizon line");
+    const float   y  = -a.pitch * PITCH_SCALE;
+    const float   l  = ATT_WIDTH * 0.75f;
+    const int32_t x1 = (int32_t)(centerX - l * cosBank - y * sinBank), y1 = (int32_t)(centerY - l * sinBank + y * cosBank);
+    const int32_t x2 = (int32_t)(centerX + l * cosBank - y * sinBank), y2 = (int32_t)(centerY + l * sinBank + y * cosBank);
+    drawSurfaceLine(att, x1, y1, x2, y2, WHITE);
+    drawSurfaceLine(att, x1, y1 + 1, x2, y2 + 1, WHITE);
+}
+
+// ---- Speed tape: CC_ISIS::drawSpeedTape() from the pre-rendered strip ----
+
+// The marks only, standing in for drawSpeedMarks(): a tick every 5 kt, longer at 10.
+static void buildSpeedStrip(const PixelSurface &strip)
+{
+    for (int32_t y = 0; y < strip.height; y++) fillSpan(strip.row(y), 0, strip.width, BLACK);
+    for (int32_t kt = 30; kt <= SPEED_TAPE_MAX; kt += 5) {
+        const int32_t y = SPEED_STRIP_MARGIN + (SPEED_TAPE_MAX - kt) / 5 * SPEED_MARK_SPACING;
+        fillSpan(strip.row(y), strip.width - (kt % 10 ? 6 : 11), strip.width, LTGRAY);
+    }
+}
+
+static int32_t drawSpeedTape(const PixelSurface &speed, const PixelSurface &strip, int32_t lastTop, const Attitude &a, Damage &damage)
+{
+    const float   speedKt = a.airspeed > 30.0f ? a.airspeed : 30.0f;
+    const int32_t yOffset = (int32_t)(3.8f * fmodf(speedKt, 20.0f)) - 35;
+    const int32_t first20 = (int32_t)(speedKt / 20.0f) * 20;
+    const int32_t top     = SPEED_STRIP_MARGIN + (SPEED_TAPE_MAX - first20 - 60) / 5 * SPEED_MARK_SPACING - yOffset;
+
+    OVERDRAW_STAGE("speed");
+    if (lastTop != INT32_MIN && abs(top - lastTop) < speed.height / 2)
+        scrollWindow(speed, strip, top, top - lastTop, BLACK);
+    else
+        blitWindow(speed, strip, top, BLACK);
+    if (top != lastTop) damage.addAll();
+    return top;
+}
+
+// ---- Heatmaps ----
+
+static void writeFile(const void *data, size_t len, void *context)
+{
+    fwrite(data, 1, len, (FILE *)context);
+}
+
+static void writeHeatmaps(const char *dir)
+{
+    for (int i = 0; i < overdraw.surfaceCount(); i++) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.ppm", dir, overdraw.surfaceName(i));
+        FILE *f = fopen(path, "wb");
+        if (!f) {
+            fprintf(stderr, "can't write %s\n", path);
+            failures++;
+            continue;
+        }
+        CHECK(overdraw.writeHeatmap(i, writeFile, f));
+        fclose(f);
+        printf("heatmap %s\n", path);
+    }
+}
+
+// ---- Replay ----
+
+static void replay(int frames, const char *dir)
+{
+    const int32_t stripHeight = SPEED_STRIP_MARGIN * 2 + (SPEED_TAPE_MAX - 30) / 5 * SPEED_MARK_SPACING + 1;
+    PixelSurface  att   = { (Pixel *)calloc(ATT_WIDTH * ATT_HEIGHT, sizeof(Pixel)), ATT_WIDTH, ATT_HEIGHT, ATT_WIDTH };
+    PixelSurface  speed = { (Pixel *)calloc(SPEED_WIDTH * ATT_HEIGHT, sizeof(Pixel)), SPEED_WIDTH, ATT_HEIGHT, SPEED_WIDTH };
+    PixelSurface  strip = { (Pixel *)calloc(SPEED_WIDTH * stripHeight, sizeof(Pixel)), SPEED_WIDTH, stripHeight, SPEED_WIDTH };
+    buildSpeedStrip(strip);
+
+    overdraw.addSurface("att", (const uint8_t *)att.pixels, att.width, att.height);
+    overdraw.addSurface("speed", (const uint8_t *)speed.pixels, speed.width, speed.height);
+
+    Damage attDamage, speedDamage;
+    attDamage.setBounds(att.width, att.height);
+    speedDamage.setBounds(speed.width, speed.height);
+
+    int32_t  speedTop   = INT32_MIN;
+    uint64_t attPushed  = 0, speedPushed = 0;
+    int      speedMoved = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        const Attitude a = flight(frame);
+
+        drawAttitude(att, a);
+        attDamage.addAll();
+        speedTop = drawSpeedTape(speed, strip, speedTop, a, speedDamage);
+
+        // CC_ISIS::present(): push the damage, then the sprite starts over.
+        attDamage.coalesce();
+        speedDamage.coalesce();
+        attPushed += attDamage.area();
+        speedPushed += speedDamage.area();
+        speedMoved += !speedDamage.empty();
+        attDamage.clear();
+        speedDamage.clear();
+        overdraw.pushed((const uint8_t *)att.pixels);
+        overdraw.pushed((const uint8_t *)speed.pixels);
+        overdraw.endFrame();
+    }
+
+    const uint32_t n = overdraw.frames() ? overdraw.frames() : 1;
+    printf("%d frames\n", frames);
+    for (int i = 0; i < overdraw.stageCount(); i++) {
+        OverdrawStats::Counts c = overdraw.stageCounts(i);
+        printf("  stage %-13s %7lu px/frame, %6lu overdrawn\n", overdraw.stageName(i), (unsigned long)(c.written / n),
+               (unsigned long)(c.overdrawn / n));
+    }
+    for (int i = 0; i < overdraw.surfaceCount(); i++) {
+        OverdrawStats::Counts c = overdraw.surfaceCounts(i);
+        printf("  sprite %-12s %7lu px/frame, %6lu overdrawn\n", overdraw.surfaceName(i), (unsigned long)(c.written / n),
+               (unsigned long)(c.overdrawn / n));
+    }
+    printf("  pushed: att %lu px/frame, speed %lu px/frame (moved in %d frames)\n", (unsigned long)(attPushed / frames),
+           (unsigned long)(speedPushed / frames), speedMoved);
+
+    // The horizon fill writes every attitude pixel once; the ladder and line only ever go over it.
+    CHECK(overdraw.surfaceCount() == 2);
+    CHECK(overdraw.stageCounts(0).written == (uint32_t)(ATT_WIDTH * ATT_HEIGHT) * n);
+    CHECK(overdraw.stageCounts(0).overdrawn == 0);
+    CHECK(overdraw.stageCounts(1).overdrawn == overdraw.stageCounts(1).written);
+    CHECK(overdraw.surfaceCounts(1).written <= (uint32_t)(SPEED_WIDTH * ATT_HEIGHT) * n);
+
+    writeHeatmaps(dir);
+    free(att.pixels);
+    free(speed.pixels);
+    free(strip.pixels);
+}
+
+// ---- Damage ----
+
+static void checkDamage()
+{
+    Damage d;
+    d.setBounds(100, 50);
+
+    d.add(-10, -10, 20, 20); // clipped to the sprite
+    CHECK(d.count() == 1 && d.rect(0).x == 0 && d.rect(0).y == 0 && d.rect(0).w == 10 && d.rect(0).h == 10);
+    d.add(2, 2, 4, 4); // inside the first
+    CHECK(d.count() == 1);
+    d.add(200, 0, 10, 10); // off the sprite
+    CHECK(d.count() == 1);
+
+    d.add(80, 40, 10, 10); // far away: stays apart
+    d.coalesce();
+    CHECK(d.count() == 2 && d.area() == 200);
+
+    d.add(5, 5, 10, 10); // overlaps the first: merged
+    d.coalesce();
+    CHECK(d.count() == 2 && d.area() == 225 + 100);
+
+    d.clear();
+    for (int i = 0; i < Damage::MAX_RECTS + 1; i++) d.add(i * 15, 0, 2, 2);
+    CHECK(d.count() == 1 && d.rect(0).w == Damage::MAX_RECTS * 15 + 2);
+
+    d.addAll();
+    d.coalesce();
+    CHECK(d.count() == 1 && d.area() == d.fullArea());
+}
+
+// ---- Seqlock ----
+
+// Every field follows from n, so a copy mixing two publishes shows.
+struct Published {
+    uint32_t n;
+    float    values[14];
+    uint32_t check;
+};
+
+static Published published(uint32_t n)
+{
+    Published p;
+    p.n = n;
+    for (int i = 0; i < 14; i++) p.values[i] = (float)(n + i);
+    p.check = ~n;
+    return p;
+}
+
+static void checkSeqlock(uint32_t publishes)
+{
+    Seqlock<Published> lock;
+    std::atomic<bool>  done{ false };
+    uint32_t           reads = 0, torn = 0, retries = 0, backwards = 0;
+    lock.publish(published(0)); // before the reader starts: there is always a whole value to read
+
+    std::thread reader([&] {
+        uint32_t last = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            Published p;
+            retries += lock.read(p);
+            reads++;
+            bool whole = p.check == ~p.n;
+            for (int i = 0; i < 14; i++) whole = whole && p.values[i] == (float)(p.n + i);
+            if (!whole) torn++;
+            if (p.n < last) backwards++;
+            last = p.n;
+        }
+    });
+
+    for (uint32_t n = 1; n < publishes; n++) lock.publish(published(n));
+    done = true;
+    reader.join();
+
+    printf("seqlock: %u publishes, %u reads, %u retries, %u torn\n", publishes, reads, retries, torn);
+    CHECK(torn == 0);
+    CHECK(backwards == 0);
+    CHECK(lock.version() == publishes);
+}
+
+int main(int argc, char **argv)
+{
+    const int   frames = argc > 1 ? atoi(argv[1]) : 600;
+    const char *dir    = argc > 2 ? argv[2] : ".";
+
+    checkDamage();
+    checkSeqlock(2000000);
+    replay(frames > 0 ? frames : 1, dir);
+
+    if (failures) fprintf(stderr, "%d checks failed\n", failures);
+    return failures ? 1 : 0;
+}